@@ -28,6 +28,11 @@ private:
 
 	PhysicsComponent* _PhysicsComponent = nullptr;
 	AnimationComponent* _AnimationComponent = nullptr;
+	//Clip id of the animation
+	int _IdleClipId = -1;
+	int _StartJumpClipId = -1;
+	int _LandClipId = -1;
+	int _VomitClipId = -1;
 
 	Isaac* _Player = nullptr;
 
@@ -87,6 +92,6 @@ private:
 	void SpawnFly();
 
 	//Call by the animation
-	void AnimationListener(int FrameIndex, const std::string& AnimationName);
+	void AnimationListener(int FrameIndex, int ClipId);
 
 };
\ No newline at end of file
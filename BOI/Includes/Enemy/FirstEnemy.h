@@ -18,6 +18,15 @@ public:
 private:
 	PhysicsComponent* _PhysicsComponent = nullptr;
 	AnimationComponent* _AnimationComponent = nullptr;
+	//Clip id of the animation
+	int _IdleDownClipId = -1;
+	int _MoveDownClipId = -1;
+	int _IdleUpClipId = -1;
+	int _MoveUpClipId = -1;
+	int _IdleRightClipId = -1;
+	int _MoveRightClipId = -1;
+	int _IdleLeftClipId = -1;
+	int _MoveLeftClipId = -1;
 
 	Isaac* _Player = nullptr;
 
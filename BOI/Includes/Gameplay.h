@@ -0,0 +1,7 @@
+#pragma once
+
+#include <string>
+
+//Create all the prototype and the scene of the game and load the first scene, the engine must be init
+//The game and the benchmark use the same gameplay, the seed give the same random run
+void InitGameplay(unsigned int Seed, const std::string& FirstScene = "SceneMenu");
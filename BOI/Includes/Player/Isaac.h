@@ -19,6 +19,8 @@ public:
 	Delegate<void> OnLose;
 	//Call when the game is won
 	Delegate<void> OnWin;
+	//Call when Isaac is destroy, at each scene change
+	Delegate<void> OnDestroyed;
 
 private:
 	PhysicsComponent* _PhysicsComponent = nullptr;
@@ -28,11 +30,16 @@ private:
 
 	//Current health
 	int _CurrHP = 10;
+	//The hit dont remove health, for the stress scene
+	bool _bInvulnerable = false;
 
 	IState* _CurrentState = nullptr;
 	std::map<std::string, IState*> _AllState;
 
 	size_t _PlayerHitSongId = 0;
+	//Load in the begin play, the async load is done when the state play it
+	size_t _PlayerLossSongId = 0;
+	size_t _PlayerWinSongId = 0;
 
 public:
 	Isaac(const std::string& Name);
@@ -55,4 +62,7 @@ private:
 
 public:
 	void SetCurrentState(const std::string& State);
+
+	size_t GetLossSongId() const { return _PlayerLossSongId; }
+	size_t GetWinSongId() const { return _PlayerWinSongId; }
 };
\ No newline at end of file
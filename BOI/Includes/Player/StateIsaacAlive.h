@@ -16,6 +16,15 @@ private:
 	PhysicsComponent* _PhysicsComponent = nullptr;
 	AtlasComponent* _AtlasComponent = nullptr;
 	AnimationComponent* _AnimationComponent = nullptr;
+	//Clip id of the body animation, find at enter
+	int _IdleDownClipId = -1;
+	int _WalkDownClipId = -1;
+	int _IdleUpClipId = -1;
+	int _WalkUpClipId = -1;
+	int _IdleRightClipId = -1;
+	int _WalkRightClipId = -1;
+	int _IdleLeftClipId = -1;
+	int _WalkLeftClipId = -1;
 
 	Vector2D<float> _LastVeloDir = Vector2D<float>(0.0f, 1.0f);
 
@@ -21,7 +21,6 @@ private:
 	float _DelayRestart = 2.0f;
 	float _CurrentDelayRestart = 0.0f;
 
-	size_t _PlayerLossSongId = 0;
 public:
 	StateIsaacDead();
 	virtual ~StateIsaacDead() = default;
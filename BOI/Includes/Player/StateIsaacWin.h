@@ -21,8 +21,6 @@ private:
 	AtlasComponent* _AtlasComponent = nullptr;
 	AnimationComponent* _AnimationComponent = nullptr;
 
-	size_t _PlayerWinSongId = 0;
-
 public:
 	StateIsaacWin();
 	virtual ~StateIsaacWin() = default;
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Object/Actor/Actor.h"
+
+using namespace NPEngine;
+
+//A prototype of the instance manager keep alive by the stress spawner
+struct StressPrototype
+{
+public:
+	//Name of the prototype in the instance manager
+	std::string Name = "";
+	//Number of copy to keep alive, use as the ratio when the density is set
+	int Count = 0;
+	//Speed of the copy at the spawn
+	float Speed = 0.0f;
+	//Name of the copy alive
+	std::vector<std::string> AliveNames;
+	//Index for the next copy name
+	size_t NextIndex = 0;
+};
+
+//Spawn copy of FirstEnemy, FlyEnemy and Projectil at random position in the tile map and kill them at the churn rate
+//For find where the world, the physics and the render stop to scale
+class StressSpawner : public Actor
+{
+private:
+	std::vector<StressPrototype> _Prototypes;
+
+	//Copy per 10000 square pixel of the tile map, 0 for use the count
+	float _Density = 0.0f;
+	//Multiply the count or the density, change with the numpad + and -
+	float _Scale = 1.0f;
+	//Copy kill and spawn again each second, change with the numpad * and /
+	float _ChurnRate = 0.0f;
+	float _ChurnAccumulator = 0.0f;
+
+	//The copy kill by the game are find with this delay
+	float _CheckDelay = 0.5f;
+	float _CurrCheckDelay = 0.0f;
+
+	//Numpad key state of the last frame, the control change on the press
+	bool _ControlKeyDown[4] = {};
+
+public:
+	StressSpawner(const std::string& Name);
+	virtual ~StressSpawner() = default;
+
+	virtual Actor* Clone(const std::string& Name, const Param& Params = Param{});
+
+	//Set the number of copy of the prototype to keep alive
+	void SetCount(const std::string& PrototypeName, int Count);
+	//Set the copy per 10000 square pixel, 0 for use the count
+	void SetDensity(float Density) { _Density = Density; }
+	//Set the number of copy kill and spawn each second
+	void SetChurnRate(float ChurnRate) { _ChurnRate = ChurnRate; }
+	//Return the number of copy alive of all the prototype
+	size_t GetAliveCount() const;
+
+protected:
+	virtual bool Initialise(const Param& Params) override;
+
+	virtual void Update(float DeltaTime) override;
+
+private:
+	//Change the scale and the churn rate with the numpad
+	void UpdateControls();
+	//Forget the copy kill by the game
+	void RemoveDeadCopies();
+
+	//Return the number of copy to keep alive in the bounds
+	int GetTargetCount(const StressPrototype& Prototype, const Rectangle2D<float>& Bounds) const;
+	//Spawn a copy at a random position in the bounds with a random velocity
+	void SpawnCopy(StressPrototype& Prototype, const Rectangle2D<float>& Bounds);
+	//Kill a random copy of the prototype
+	void KillCopy(StressPrototype& Prototype);
+};
@@ -30,8 +30,8 @@ void BossEnemy::BeginPlay()
 {
     AI::BeginPlay();
 
-	_EnemyHitSongId = Engine::GetAudio()->LoadSound("EnemyHitSong.mp3");
-	_SpawnFlySongId = Engine::GetAudio()->LoadSound("SpawnFlySong.mp3");
+	_EnemyHitSongId = Engine::GetAudio()->LoadSoundAsync("EnemyHitSong.mp3");
+	_SpawnFlySongId = Engine::GetAudio()->LoadSoundAsync("SpawnFlySong.mp3");
 
 	Vector2D<int> ScreenSize = Engine::GetGraphics()->GetScreenSize();
 	Vector2D<float> FScreenSize = Vector2D<float>(static_cast<float>(ScreenSize.X), static_cast<float>(ScreenSize.Y));
@@ -60,7 +60,7 @@ void BossEnemy::BeginPlay()
 
 	if (_AnimationComponent)
 	{
-		_AnimationComponent->LoadTexture(std::string("bossEnemy.png"));
+		_AnimationComponent->LoadTexture(std::string("BossEnemy.png"));
 		_AnimationComponent->SetTileSize(Vector2D<int>(80, 96));
 
 		AnimationData IdleAnimation = AnimationData();
@@ -69,8 +69,7 @@ void BossEnemy::BeginPlay()
 		IdleAnimation.EndIndex = 0;
 		IdleAnimation.bLoop = false;
 		IdleAnimation.AddFrameToCallObserver(0);
-		IdleAnimation.AnimationObserver.AddFunction(this, &BossEnemy::AnimationListener);
-		_AnimationComponent->AddAnimation(std::string("IdleAnimation"), IdleAnimation);
+		_IdleClipId = _AnimationComponent->AddAnimation(std::string("IdleAnimation"), IdleAnimation);
 
 		AnimationData StartJumpAnimation = AnimationData();
 		StartJumpAnimation.FrameInterval = 0.2f;
@@ -79,7 +78,7 @@ void BossEnemy::BeginPlay()
 		StartJumpAnimation.SwitchAnimationData.bSwitchAnimation = true;
 		StartJumpAnimation.SwitchAnimationData.SwitchIndex = 5;
 		StartJumpAnimation.SwitchAnimationData.SwitchAnimationName = std::string("JumpLoopAnimation");
-		_AnimationComponent->AddAnimation(std::string("StartJumpAnimation"), StartJumpAnimation);
+		_StartJumpClipId = _AnimationComponent->AddAnimation(std::string("StartJumpAnimation"), StartJumpAnimation);
 
 		AnimationData JumpLoopAnimation = AnimationData();
 		JumpLoopAnimation.FrameInterval = 0.2f;
@@ -94,7 +93,7 @@ void BossEnemy::BeginPlay()
 		LandAnimation.SwitchAnimationData.bSwitchAnimation = true;
 		LandAnimation.SwitchAnimationData.SwitchIndex = 8;
 		LandAnimation.SwitchAnimationData.SwitchAnimationName = std::string("IdleAnimation");
-		_AnimationComponent->AddAnimation(std::string("LandAnimation"), LandAnimation);
+		_LandClipId = _AnimationComponent->AddAnimation(std::string("LandAnimation"), LandAnimation);
 
 		AnimationData VomitAnimation = AnimationData();
 		VomitAnimation.FrameInterval = 0.2f;
@@ -104,10 +103,10 @@ void BossEnemy::BeginPlay()
 		VomitAnimation.SwitchAnimationData.SwitchIndex = 9;
 		VomitAnimation.SwitchAnimationData.SwitchAnimationName = std::string("IdleAnimation");
 		VomitAnimation.AddFrameToCallObserver(9);
-		VomitAnimation.AnimationObserver.AddFunction(this, &BossEnemy::AnimationListener);
-		_AnimationComponent->AddAnimation(std::string("VomitAnimation"), VomitAnimation);
+		_VomitClipId = _AnimationComponent->AddAnimation(std::string("VomitAnimation"), VomitAnimation);
 
-		_AnimationComponent->SetCurrentAnimation(std::string("IdleAnimation"));
+		_AnimationComponent->AnimationObserver.AddFunction(this, &BossEnemy::AnimationListener);
+		_AnimationComponent->SetCurrentAnimation(_IdleClipId);
 	}
 
 	//#AI -----------
@@ -149,6 +148,7 @@ void BossEnemy::TakeHit(float Damage)
 	if (_CurrentHealth <= 0)
 	{
 		_Player->SetCurrentState(std::string("Win"));
+		_Player->OnWin.Broadcast();
 		Engine::GetWorld()->DeleteActorByName(GetName());
 
 		std::vector<FlyEnemy*> FlyEnemies = Engine::GetWorld()->GetAllActorOfClass<FlyEnemy>();
@@ -249,13 +249,13 @@ void BossEnemy::Jump(const Vector2D<float> JumpLocation)
 	_CurrentBossState = Jumping;
 
 	_JumpDesiredPosition = JumpLocation;
-	_AnimationComponent->SetCurrentAnimation(std::string("StartJumpAnimation"));
+	_AnimationComponent->SetCurrentAnimation(_StartJumpClipId);
 }
 
 void BossEnemy::Land()
 {
 	_bIsCurrentlyLanding = true;
-	_AnimationComponent->SetCurrentAnimation(std::string("LandAnimation"));
+	_AnimationComponent->SetCurrentAnimation(_LandClipId);
 }
 
 void BossEnemy::Vomit()
@@ -263,7 +263,7 @@ void BossEnemy::Vomit()
 	if (_CurrentBossState != Thinking) return;
 	_CurrentBossState = Vomiting;
 
-	_AnimationComponent->SetCurrentAnimation(std::string("VomitAnimation"));
+	_AnimationComponent->SetCurrentAnimation(_VomitClipId);
 }
 
 void BossEnemy::UpdateJump(float DeltaTime)
@@ -293,14 +293,14 @@ void BossEnemy::SpawnFly()
 	BossEnemy::CurrentNumberOfFlyEnemySpawn++;
 }
 
-void BossEnemy::AnimationListener(int FrameIndex, const std::string& AnimationName)
+void BossEnemy::AnimationListener(int FrameIndex, int ClipId)
 {
-	if (AnimationName == std::string("IdleAnimation"))
+	if (ClipId == _IdleClipId)
 	{
 		_CurrentBossState = Thinking;
 		_bIsCurrentlyLanding = false;
 	}
-	else if (AnimationName == std::string("VomitAnimation"))
+	else if (ClipId == _VomitClipId)
 	{
 		SpawnFly();
 	}
@@ -49,7 +49,7 @@ void FirstEnemy::BeginPlay()
 {
 	AI::BeginPlay();
 
-	_EnemyHitSongId = Engine::GetAudio()->LoadSound("EnemyHitSong.mp3");
+	_EnemyHitSongId = Engine::GetAudio()->LoadSoundAsync("EnemyHitSong.mp3");
 
 	Door* CurrDoor = Engine::GetWorld()->GetActorOfClass<Door>();
 	if (CurrDoor)
@@ -89,53 +89,53 @@ void FirstEnemy::BeginPlay()
 		IdleDownAnimation.FrameInterval = 100.0f;
 		IdleDownAnimation.StartIndex = 8;
 		IdleDownAnimation.EndIndex = 8;
-		_AnimationComponent->AddAnimation(std::string("IdleDownAnimation"), IdleDownAnimation);
+		_IdleDownClipId = _AnimationComponent->AddAnimation(std::string("IdleDownAnimation"), IdleDownAnimation);
 
 		AnimationData MoveDownAnimation = AnimationData();
 		MoveDownAnimation.FrameInterval = 0.2f;
 		MoveDownAnimation.StartIndex = 8;
 		MoveDownAnimation.EndIndex = 11;
-		_AnimationComponent->AddAnimation(std::string("MoveDownAnimation"), MoveDownAnimation);
+		_MoveDownClipId = _AnimationComponent->AddAnimation(std::string("MoveDownAnimation"), MoveDownAnimation);
 
 		AnimationData IdleUpAnimation = AnimationData();
 		IdleUpAnimation.FrameInterval = 100.0f;
 		IdleUpAnimation.StartIndex = 4;
 		IdleUpAnimation.EndIndex = 4;
-		_AnimationComponent->AddAnimation(std::string("IdleUpAnimation"), IdleUpAnimation);
+		_IdleUpClipId = _AnimationComponent->AddAnimation(std::string("IdleUpAnimation"), IdleUpAnimation);
 
 		AnimationData MoveUpAnimation = AnimationData();
 		MoveUpAnimation.FrameInterval = 0.2f;
 		MoveUpAnimation.StartIndex = 4;
 		MoveUpAnimation.EndIndex = 7;
-		_AnimationComponent->AddAnimation(std::string("MoveUpAnimation"), MoveUpAnimation);
+		_MoveUpClipId = _AnimationComponent->AddAnimation(std::string("MoveUpAnimation"), MoveUpAnimation);
 
 		AnimationData IdleRightAnimation = AnimationData();
 		IdleRightAnimation.FrameInterval = 100.0f;
 		IdleRightAnimation.StartIndex = 0;
 		IdleRightAnimation.EndIndex = 0;
-		_AnimationComponent->AddAnimation(std::string("IdleRightAnimation"), IdleRightAnimation);
+		_IdleRightClipId = _AnimationComponent->AddAnimation(std::string("IdleRightAnimation"), IdleRightAnimation);
 
 		AnimationData MoveRightAnimation = AnimationData();
 		MoveRightAnimation.FrameInterval = 0.2f;
 		MoveRightAnimation.StartIndex = 0;
 		MoveRightAnimation.EndIndex = 3;
-		_AnimationComponent->AddAnimation(std::string("MoveRightAnimation"), MoveRightAnimation);
+		_MoveRightClipId = _AnimationComponent->AddAnimation(std::string("MoveRightAnimation"), MoveRightAnimation);
 
 		AnimationData IdleLeftAnimation = AnimationData();
 		IdleLeftAnimation.FrameInterval = 100.0f;
 		IdleLeftAnimation.StartIndex = 0;
 		IdleLeftAnimation.EndIndex = 0;
 		IdleLeftAnimation.AnimationFlip.Horizontal = true;
-		_AnimationComponent->AddAnimation(std::string("IdleLeftAnimation"), IdleLeftAnimation);
+		_IdleLeftClipId = _AnimationComponent->AddAnimation(std::string("IdleLeftAnimation"), IdleLeftAnimation);
 
 		AnimationData MoveLeftAnimation = AnimationData();
 		MoveLeftAnimation.FrameInterval = 0.2f;
 		MoveLeftAnimation.StartIndex = 0;
 		MoveLeftAnimation.EndIndex = 3;
 		MoveLeftAnimation.AnimationFlip.Horizontal = true;
-		_AnimationComponent->AddAnimation(std::string("MoveLeftAnimation"), MoveLeftAnimation);
+		_MoveLeftClipId = _AnimationComponent->AddAnimation(std::string("MoveLeftAnimation"), MoveLeftAnimation);
 
-		_AnimationComponent->SetCurrentAnimation(std::string("MoveDownAnimation"));
+		_AnimationComponent->SetCurrentAnimation(_MoveDownClipId);
 		_AnimationComponent->SetOffsetSize(Vector2D<float>(40.0f, 40.0f));
 		_AnimationComponent->SetOffsetPosition(Vector2D<float>(-20.0f, -20.0f));
 	}
@@ -156,38 +156,38 @@ void FirstEnemy::Update(float DeltaTime)
 	{
 		if (CurrVeloDir.Y > 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("MoveDownAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_MoveDownClipId);
 		}
 		else if (CurrVeloDir.Y < 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("MoveUpAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_MoveUpClipId);
 		}
 		else if (CurrVeloDir.X > 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("MoveRightAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_MoveRightClipId);
 		}
 		else if (CurrVeloDir.X < 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("MoveLeftAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_MoveLeftClipId);
 		}
 	}
 	else if (_LastVeloDir.Magnitude() > 0.0f && CurrVeloDir.Magnitude() == 0.0f)
 	{
 		if (_LastVeloDir.Y > 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("IdleDownAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_IdleDownClipId);
 		}
 		else if (_LastVeloDir.Y < 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("IdleUpAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_IdleUpClipId);
 		}
 		else if (_LastVeloDir.X > 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("IdleRightAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_IdleRightClipId);
 		}
 		else if (_LastVeloDir.X < 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("IdleLeftAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_IdleLeftClipId);
 		}
 	}
 
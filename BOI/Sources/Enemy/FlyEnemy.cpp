@@ -45,12 +45,16 @@ void FlyEnemy::BeginPlay()
 {
     AI::BeginPlay();
 
-	_EnemyHitSongId = Engine::GetAudio()->LoadSound("EnemyHitSong.mp3");
+	_EnemyHitSongId = Engine::GetAudio()->LoadSoundAsync("EnemyHitSong.mp3");
 
+	//Without boss, like in the stress scene, the fly stay at is spawn position
 	BossEnemy* CurrBossEnemy = Engine::GetWorld()->GetActorOfClass<BossEnemy>();
-	Vector2D<float> BossCenterPosition = CurrBossEnemy->GetPosition() + CurrBossEnemy->GetSize() / 2;
-	Vector2D<float> SpawnPosition = BossCenterPosition + Vector2D<float>(-GetSize().X / 2, -100.0f);
-	SetPosition(SpawnPosition);
+	if (CurrBossEnemy)
+	{
+		Vector2D<float> BossCenterPosition = CurrBossEnemy->GetPosition() + CurrBossEnemy->GetSize() / 2;
+		Vector2D<float> SpawnPosition = BossCenterPosition + Vector2D<float>(-GetSize().X / 2, -100.0f);
+		SetPosition(SpawnPosition);
+	}
 
 	if (_PhysicsComponent)
 	{
@@ -75,9 +79,9 @@ void FlyEnemy::BeginPlay()
 		BaseAnimation.FrameInterval = 0.1f;
 		BaseAnimation.StartIndex = 0;
 		BaseAnimation.EndIndex = 1;
-		_AnimationComponent->AddAnimation(std::string("BaseAnimation"), BaseAnimation);
+		int BaseClipId = _AnimationComponent->AddAnimation(std::string("BaseAnimation"), BaseAnimation);
 		
-		_AnimationComponent->SetCurrentAnimation(std::string("BaseAnimation"));
+		_AnimationComponent->SetCurrentAnimation(BaseClipId);
 	}
 
 	//#AI -----------
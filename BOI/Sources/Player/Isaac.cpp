@@ -18,6 +18,12 @@ bool Isaac::Initialise(const Param& Params)
 {
 	Actor::Initialise(Params);
 
+	auto IT = Params.find(std::string("Invulnerable"));
+	if (IT != Params.end())
+	{
+		_bInvulnerable = std::any_cast<bool>(IT->second);
+	}
+
 	CreateComponentOfClass<PhysicsComponent>(std::string("PhysicsComponent"), Params);
 	CreateComponentOfClass<ControllerComponent>(std::string("ControllerComponent"), Params);
 	CreateComponentOfClass<AtlasComponent>(std::string("AtlasComponent"), Params);
@@ -31,6 +37,8 @@ bool Isaac::Initialise(const Param& Params)
 
 void Isaac::Destroy(const Param& Params)
 {
+	OnDestroyed.Broadcast();
+
 	Actor::Destroy(Params);
 
 	for (auto IT : _AllState)
@@ -56,7 +64,9 @@ void Isaac::BeginPlay()
 	Vector2D<float> Position = Vector2D<float>((ScreenSize.X / 2) - (Size.X / 2), ScreenSize.Y - 164.0f);
 	SetPosition(Position);
 
-	_PlayerHitSongId = Engine::GetAudio()->LoadSound(std::string("PlayerHit.mp3"));
+	_PlayerHitSongId = Engine::GetAudio()->LoadSoundAsync(std::string("PlayerHit.mp3"));
+	_PlayerLossSongId = Engine::GetAudio()->LoadSoundAsync(std::string("LossSong.mp3"));
+	_PlayerWinSongId = Engine::GetAudio()->LoadSoundAsync(std::string("WinSong.mp3"));
 
 	_AllState["Alive"] = new StateIsaacAlive();
 	_AllState["Dead"] = new StateIsaacDead();
@@ -187,7 +197,7 @@ Actor* Isaac::Clone(const std::string& Name, const Param& Params)
 
 void Isaac::TakeHit(float Damage)
 {
-	if (_CurrHP <= 0) return;
+	if (_CurrHP <= 0 || _bInvulnerable) return;
 
 	Engine::GetAudio()->PlaySound(_PlayerHitSongId);
 
@@ -9,7 +9,7 @@ StateIsaacAlive::StateIsaacAlive()
 
 void StateIsaacAlive::OnEnter(Object* Owner)
 {
-	_ShootSoundId = Engine::GetAudio()->LoadSound(std::string("ShootSong.mp3"));
+	_ShootSoundId = Engine::GetAudio()->LoadSoundAsync(std::string("ShootSong.mp3"));
 
 	_OwnerIsaac = static_cast<Isaac*>(Owner);
 
@@ -38,7 +38,17 @@ void StateIsaacAlive::OnEnter(Object* Owner)
 		_AnimationComponent->SetTileSize(Vector2D<int>(32, 32));
 		_AnimationComponent->SetOffsetPosition(Vector2D<float>(2.0f, 25.0f));
 		_AnimationComponent->SetOffsetSize(Vector2D<float>(0.0f, 0.0f));
-		_AnimationComponent->SetCurrentAnimation(std::string("IdleDownAnimation"));
+
+		_IdleDownClipId = _AnimationComponent->GetAnimationId(std::string("IdleDownAnimation"));
+		_WalkDownClipId = _AnimationComponent->GetAnimationId(std::string("WalkDownAnimation"));
+		_IdleUpClipId = _AnimationComponent->GetAnimationId(std::string("IdleUpAnimation"));
+		_WalkUpClipId = _AnimationComponent->GetAnimationId(std::string("WalkUpAnimation"));
+		_IdleRightClipId = _AnimationComponent->GetAnimationId(std::string("IdleRightAnimation"));
+		_WalkRightClipId = _AnimationComponent->GetAnimationId(std::string("WalkRightAnimation"));
+		_IdleLeftClipId = _AnimationComponent->GetAnimationId(std::string("IdleLeftAnimation"));
+		_WalkLeftClipId = _AnimationComponent->GetAnimationId(std::string("WalkLeftAnimation"));
+
+		_AnimationComponent->SetCurrentAnimation(_IdleDownClipId);
 	}
 }
 
@@ -124,38 +134,38 @@ void StateIsaacAlive::UpdateBodyAnimation()
 	{
 		if (CurrVeloDir.Y > 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("WalkDownAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_WalkDownClipId);
 		}
 		else if (CurrVeloDir.Y < 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("WalkUpAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_WalkUpClipId);
 		}
 		else if (CurrVeloDir.X > 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("WalkRightAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_WalkRightClipId);
 		}
 		else if (CurrVeloDir.X < 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("WalkLeftAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_WalkLeftClipId);
 		}
 	}
 	else if (_LastVeloDir.Magnitude() > 0.0f && CurrVeloDir.Magnitude() == 0.0f)
 	{
 		if (_LastVeloDir.Y > 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("IdleDownAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_IdleDownClipId);
 		}
 		else if (_LastVeloDir.Y < 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("IdleUpAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_IdleUpClipId);
 		}
 		else if (_LastVeloDir.X > 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("IdleRightAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_IdleRightClipId);
 		}
 		else if (_LastVeloDir.X < 0.0f)
 		{
-			_AnimationComponent->SetCurrentAnimation(std::string("IdleLeftAnimation"));
+			_AnimationComponent->SetCurrentAnimation(_IdleLeftClipId);
 		}
 	}
 
@@ -7,12 +7,11 @@ StateIsaacDead::StateIsaacDead()
 
 void StateIsaacDead::OnEnter(Object* Owner)
 {
-	_PlayerLossSongId = Engine::GetAudio()->LoadSound(std::string("LossSong.mp3"));
-	Engine::GetAudio()->PlaySound(_PlayerLossSongId);
+	_OwnerIsaac = static_cast<Isaac*>(Owner);
 
-	Engine::GetWorld()->RemoveInPersistenteData(std::string("PlayerHP"));
+	Engine::GetAudio()->PlaySound(_OwnerIsaac->GetLossSongId());
 
-	_OwnerIsaac = static_cast<Isaac*>(Owner);
+	Engine::GetWorld()->RemoveInPersistenteData(std::string("PlayerHP"));
 
 	_PhysicsComponent = _OwnerIsaac->GetComponentOfClass<PhysicsComponent>();
 	{
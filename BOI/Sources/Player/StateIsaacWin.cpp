@@ -7,12 +7,11 @@ StateIsaacWin::StateIsaacWin()
 
 void StateIsaacWin::OnEnter(Object* Owner)
 {
-	_PlayerWinSongId = Engine::GetAudio()->LoadSound(std::string("WinSong.mp3"));
-	Engine::GetAudio()->PlaySound(_PlayerWinSongId);
+	_OwnerIsaac = static_cast<Isaac*>(Owner);
 
-	Engine::GetWorld()->RemoveInPersistenteData(std::string("PlayerHP"));
+	Engine::GetAudio()->PlaySound(_OwnerIsaac->GetWinSongId());
 
-	_OwnerIsaac = static_cast<Isaac*>(Owner);
+	Engine::GetWorld()->RemoveInPersistenteData(std::string("PlayerHP"));
 
 	_PhysicsComponent = _OwnerIsaac->GetComponentOfClass<PhysicsComponent>();
 	{
@@ -0,0 +1,243 @@
+#include "StressSpawner.h"
+#include "Engine.h"
+#include "Object/Actor/TileMap.h"
+
+#include <algorithm>
+#include <cmath>
+
+StressSpawner::StressSpawner(const std::string& Name) : Actor(Name)
+{
+}
+
+Actor* StressSpawner::Clone(const std::string& Name, const Param& Params)
+{
+	StressSpawner* NewStressSpawner = new StressSpawner(Name);
+	return NewStressSpawner;
+}
+
+bool StressSpawner::Initialise(const Param& Params)
+{
+	bool bSucces = Actor::Initialise(Params);
+
+	//Prototype of the gameplay, the count are replace by the params
+	StressPrototype FirstEnemyPrototype = StressPrototype();
+	FirstEnemyPrototype.Name = "FirstEnemy";
+	FirstEnemyPrototype.Speed = 100.0f;
+	_Prototypes.push_back(FirstEnemyPrototype);
+
+	StressPrototype FlyEnemyPrototype = StressPrototype();
+	FlyEnemyPrototype.Name = "FlyEnemy";
+	FlyEnemyPrototype.Speed = 150.0f;
+	_Prototypes.push_back(FlyEnemyPrototype);
+
+	StressPrototype ProjectilPrototype = StressPrototype();
+	ProjectilPrototype.Name = "StressProjectil";
+	ProjectilPrototype.Speed = 400.0f;
+	_Prototypes.push_back(ProjectilPrototype);
+
+	auto IT = Params.find(std::string("FirstEnemyCount"));
+	if (IT != Params.end())
+	{
+		SetCount("FirstEnemy", std::any_cast<int>(IT->second));
+	}
+
+	IT = Params.find(std::string("FlyEnemyCount"));
+	if (IT != Params.end())
+	{
+		SetCount("FlyEnemy", std::any_cast<int>(IT->second));
+	}
+
+	IT = Params.find(std::string("ProjectilCount"));
+	if (IT != Params.end())
+	{
+		SetCount("StressProjectil", std::any_cast<int>(IT->second));
+	}
+
+	IT = Params.find(std::string("Density"));
+	if (IT != Params.end())
+	{
+		SetDensity(std::any_cast<float>(IT->second));
+	}
+
+	IT = Params.find(std::string("ChurnRate"));
+	if (IT != Params.end())
+	{
+		SetChurnRate(std::any_cast<float>(IT->second));
+	}
+
+	return bSucces;
+}
+
+void StressSpawner::Update(float DeltaTime)
+{
+	Actor::Update(DeltaTime);
+
+	UpdateControls();
+
+	//Wait the tile map, it is load on a worker
+	TileMap* CurrTileMap = Engine::GetWorld()->GetActorOfClass<TileMap>();
+	if (!CurrTileMap) return;
+	Rectangle2D<float> Bounds = CurrTileMap->GetBounds();
+	if (Bounds.Size.X <= 0.0f || Bounds.Size.Y <= 0.0f) return;
+
+	_CurrCheckDelay += DeltaTime;
+	if (_CurrCheckDelay >= _CheckDelay)
+	{
+		_CurrCheckDelay = 0.0f;
+		RemoveDeadCopies();
+	}
+
+	//Kill at the churn rate, the kill copy are spawn again below
+	_ChurnAccumulator += _ChurnRate * DeltaTime;
+	int ChurnCount = static_cast<int>(_ChurnAccumulator);
+	_ChurnAccumulator -= static_cast<float>(ChurnCount);
+	for (int i = 0; i < ChurnCount; i++)
+	{
+		KillCopy(_Prototypes[rand() % _Prototypes.size()]);
+	}
+
+	for (StressPrototype& Prototype : _Prototypes)
+	{
+		int TargetCount = GetTargetCount(Prototype, Bounds);
+		while (static_cast<int>(Prototype.AliveNames.size()) < TargetCount)
+		{
+			SpawnCopy(Prototype, Bounds);
+		}
+		while (static_cast<int>(Prototype.AliveNames.size()) > TargetCount)
+		{
+			KillCopy(Prototype);
+		}
+	}
+}
+
+void StressSpawner::UpdateControls()
+{
+	IInput* Input = Engine::GetInput();
+	bool KeyDown[4] =
+	{
+		Input->IsKeyDown(Key_NumpadAdd),
+		Input->IsKeyDown(Key_NumpadSubtract),
+		Input->IsKeyDown(Key_NumpadMultiply),
+		Input->IsKeyDown(Key_NumpadDivide)
+	};
+
+	bool bChange = false;
+	if (KeyDown[0] && !_ControlKeyDown[0])
+	{
+		_Scale *= 2.0f;
+		bChange = true;
+	}
+	if (KeyDown[1] && !_ControlKeyDown[1])
+	{
+		_Scale /= 2.0f;
+		bChange = true;
+	}
+	if (KeyDown[2] && !_ControlKeyDown[2])
+	{
+		_ChurnRate = _ChurnRate > 0.0f ? _ChurnRate * 2.0f : 1.0f;
+		bChange = true;
+	}
+	if (KeyDown[3] && !_ControlKeyDown[3])
+	{
+		_ChurnRate /= 2.0f;
+		bChange = true;
+	}
+	std::copy(std::begin(KeyDown), std::end(KeyDown), std::begin(_ControlKeyDown));
+
+	if (bChange)
+	{
+		Engine::GetLogger()->LogMessage("Stress scale %.2f, churn rate %.1f per second, %zu copy alive", _Scale, _ChurnRate, GetAliveCount());
+	}
+}
+
+void StressSpawner::RemoveDeadCopies()
+{
+	for (StressPrototype& Prototype : _Prototypes)
+	{
+		std::vector<std::string>& AliveNames = Prototype.AliveNames;
+		AliveNames.erase(std::remove_if(AliveNames.begin(), AliveNames.end(), [](const std::string& Name)
+		{
+			return Engine::GetWorld()->GetActorByName(Name) == nullptr;
+		}), AliveNames.end());
+	}
+}
+
+int StressSpawner::GetTargetCount(const StressPrototype& Prototype, const Rectangle2D<float>& Bounds) const
+{
+	if (_Density <= 0.0f)
+	{
+		return static_cast<int>(std::round(Prototype.Count * _Scale));
+	}
+
+	//The density give the total, the count give the part of each prototype
+	int CountSum = 0;
+	for (const StressPrototype& CurrPrototype : _Prototypes)
+	{
+		CountSum += CurrPrototype.Count;
+	}
+	float Ratio = CountSum > 0 ? static_cast<float>(Prototype.Count) / CountSum : 1.0f / _Prototypes.size();
+
+	float Total = _Density * _Scale * (Bounds.Size.X * Bounds.Size.Y) / 10000.0f;
+	return static_cast<int>(std::round(Total * Ratio));
+}
+
+void StressSpawner::SpawnCopy(StressPrototype& Prototype, const Rectangle2D<float>& Bounds)
+{
+	//Stay out of the wall on the border
+	const float Margin = 64.0f;
+	float RandomX = static_cast<float>(rand()) / RAND_MAX;
+	float RandomY = static_cast<float>(rand()) / RAND_MAX;
+	Vector2D<float> Position = Vector2D<float>(
+		Bounds.Position.X + Margin + RandomX * std::max(Bounds.Size.X - Margin * 2.0f, 0.0f),
+		Bounds.Position.Y + Margin + RandomY * std::max(Bounds.Size.Y - Margin * 2.0f, 0.0f));
+
+	float Angle = static_cast<float>(rand()) / RAND_MAX * 6.2831853f;
+	Vector2D<float> Direction = Vector2D<float>(std::cos(Angle), std::sin(Angle));
+
+	std::string CopyName = "Stress" + Prototype.Name + std::to_string(Prototype.NextIndex);
+	Prototype.NextIndex++;
+
+	//The projectil use the direction and the speed, the enemy the velocity
+	Actor* Copy = Engine::GetInstanceManager()->SpawnCopyInWorldAt(Prototype.Name, CopyName,
+	{
+		{"Position", Position},
+		{"Velocity", Direction * Prototype.Speed},
+		{"Direction", Direction},
+		{"MoveSpeed", Prototype.Speed}
+	});
+	if (!Copy) return;
+
+	Prototype.AliveNames.push_back(CopyName);
+}
+
+void StressSpawner::KillCopy(StressPrototype& Prototype)
+{
+	if (Prototype.AliveNames.empty()) return;
+
+	size_t Index = rand() % Prototype.AliveNames.size();
+	Engine::GetWorld()->DeleteActorByName(Prototype.AliveNames[Index]);
+
+	Prototype.AliveNames[Index] = Prototype.AliveNames.back();
+	Prototype.AliveNames.pop_back();
+}
+
+void StressSpawner::SetCount(const std::string& PrototypeName, int Count)
+{
+	for (StressPrototype& Prototype : _Prototypes)
+	{
+		if (Prototype.Name == PrototypeName)
+		{
+			Prototype.Count = std::max(Count, 0);
+		}
+	}
+}
+
+size_t StressSpawner::GetAliveCount() const
+{
+	size_t Count = 0;
+	for (const StressPrototype& Prototype : _Prototypes)
+	{
+		Count += Prototype.AliveNames.size();
+	}
+	return Count;
+}
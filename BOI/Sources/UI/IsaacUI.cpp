@@ -23,11 +23,14 @@ void IsaacUI::Draw()
 {
 	Vector2D<float> CurrHeartPostion = _FirstHeartPosition;
 
+	//The heart stay on the screen when the camera move
+	Engine::GetGraphics()->SetScreenSpace(true);
 	for (int i = 0; i < _CurrentHealth; i++)
 	{
 		Engine::GetGraphics()->DrawTexture(_TextureID, Rectangle2D<float>(CurrHeartPostion, _HeartSize));
 		CurrHeartPostion.X += _HeartSize.X + _Spacer;
 	}
+	Engine::GetGraphics()->SetScreenSpace(false);
 }
 
 void IsaacUI::OnHealthChanged(int CurrHealth)
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <cstdint>
+
+//Return the number of global new since the start of the process, the engine and the game use the global new
+uint64_t GetAllocationCount();
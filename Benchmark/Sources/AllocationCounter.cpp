@@ -0,0 +1,44 @@
+#include "AllocationCounter.h"
+#include "Memory/MemoryTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef ENABLE_MEMORY_TRACKING
+
+//The engine already hook the global new, use is count
+uint64_t GetAllocationCount()
+{
+	return NPEngine::MemoryTracker::GetAllocationCount();
+}
+
+#else
+
+//All the allocation of the process, relaxed because only the count is read
+static std::atomic<uint64_t> AllocationCount = 0;
+
+uint64_t GetAllocationCount()
+{
+	return AllocationCount.load(std::memory_order_relaxed);
+}
+
+void* operator new(size_t Size)
+{
+	AllocationCount.fetch_add(1, std::memory_order_relaxed);
+	void* Memory = std::malloc(Size > 0 ? Size : 1);
+	if (!Memory) throw std::bad_alloc();
+	return Memory;
+}
+
+void operator delete(void* Memory) noexcept
+{
+	std::free(Memory);
+}
+
+void operator delete(void* Memory, size_t Size) noexcept
+{
+	std::free(Memory);
+}
+
+#endif
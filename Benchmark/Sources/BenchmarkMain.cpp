@@ -0,0 +1,302 @@
+#include "Engine.h"
+#include "Input/NullInput.h"
+#include "Gameplay.h"
+#include "AllocationCounter.h"
+#include "Memory/MemoryTracker.h"
+#include "Profiler/Profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace NPEngine;
+
+//Input script ----------------------------------------------------------------------
+
+//One key down from the start frame to the end frame, the script loop on the biggest end frame
+struct ScriptKey
+{
+public:
+	EKeyboardKeys Key = Key_None;
+	int StartFrame = 0;
+	int EndFrame = 0;
+};
+
+//Return the key of the name, Key_None if unknow
+static EKeyboardKeys GetKeyByName(const std::string& Name)
+{
+	if (Name.size() == 1 && Name[0] >= 'A' && Name[0] <= 'Z') return static_cast<EKeyboardKeys>(Key_A + (Name[0] - 'A'));
+	if (Name == "Up") return Key_UpArrow;
+	if (Name == "Down") return Key_DownArrow;
+	if (Name == "Left") return Key_LeftArrow;
+	if (Name == "Right") return Key_RightArrow;
+	if (Name == "Space") return Key_Space;
+	return Key_None;
+}
+
+//Read a script like "D:0-60,Right:0-30", return false if a part is not valid
+static bool ParseScript(const std::string& Text, std::vector<ScriptKey>* OutScript)
+{
+	size_t Start = 0;
+	while (Start < Text.size())
+	{
+		size_t End = Text.find(',', Start);
+		if (End == std::string::npos) End = Text.size();
+		std::string Part = Text.substr(Start, End - Start);
+		Start = End + 1;
+
+		size_t Colon = Part.find(':');
+		size_t Dash = Part.find('-', Colon);
+		if (Colon == std::string::npos || Dash == std::string::npos) return false;
+
+		ScriptKey NewKey = ScriptKey();
+		NewKey.Key = GetKeyByName(Part.substr(0, Colon));
+		NewKey.StartFrame = std::atoi(Part.substr(Colon + 1, Dash - Colon - 1).c_str());
+		NewKey.EndFrame = std::atoi(Part.substr(Dash + 1).c_str());
+		if (NewKey.Key == Key_None || NewKey.EndFrame <= NewKey.StartFrame) return false;
+
+		OutScript->push_back(NewKey);
+	}
+	return !OutScript->empty();
+}
+
+//Walk in a square and shoot in the four direction, Isaac move in all the room
+static const char* DefaultScript = "D:0-60,S:60-120,A:120-180,W:180-240,Right:0-30,Down:30-60,Left:60-90,Up:90-120,Right:120-150,Down:150-180,Left:180-210,Up:210-240";
+
+//Set the key of the frame in the input, the delegate are call in the frame
+static void ApplyScript(const std::vector<ScriptKey>& Script, int Frame, NullInput* Input)
+{
+	int Length = 1;
+	for (const ScriptKey& CurrKey : Script)
+	{
+		Length = std::max(Length, CurrKey.EndFrame);
+	}
+	int ScriptFrame = Frame % Length;
+
+	Input->ReleaseAll();
+	for (const ScriptKey& CurrKey : Script)
+	{
+		if (ScriptFrame >= CurrKey.StartFrame && ScriptFrame < CurrKey.EndFrame)
+		{
+			Input->SetKeyDown(CurrKey.Key, true);
+		}
+	}
+}
+
+//Report ----------------------------------------------------------------------------
+
+//Return the time in nanosecond under which are Percent of the value, the value are sort
+static uint64_t GetPercentile(const std::vector<uint64_t>& SortedValues, double Percent)
+{
+	if (SortedValues.empty()) return 0;
+	size_t Rank = static_cast<size_t>(Percent / 100.0 * SortedValues.size() + 0.999999);
+	return SortedValues[std::clamp<size_t>(Rank, 1, SortedValues.size()) - 1];
+}
+
+//Print one line of the report, FramePhase_Count for all the frame
+static void PrintPhase(const std::vector<FrameTimes>& Frames, EFramePhase Phase)
+{
+	std::vector<uint64_t> Times;
+	Times.reserve(Frames.size());
+	uint64_t Sum = 0;
+	for (const FrameTimes& Frame : Frames)
+	{
+		uint64_t Time = Phase == FramePhase_Count ? Frame.Total : Frame.Phases[Phase];
+		Times.push_back(Time);
+		Sum += Time;
+	}
+	std::sort(Times.begin(), Times.end());
+
+	const char* Name = Phase == FramePhase_Count ? "Frame" : FrameStatistics::GetPhaseName(Phase);
+	printf("%-14s %12llu %12llu %12llu %12llu %12llu\n", Name,
+		static_cast<unsigned long long>(Frames.empty() ? 0 : Sum / Frames.size()),
+		static_cast<unsigned long long>(GetPercentile(Times, 50.0)),
+		static_cast<unsigned long long>(GetPercentile(Times, 95.0)),
+		static_cast<unsigned long long>(GetPercentile(Times, 99.0)),
+		static_cast<unsigned long long>(Times.empty() ? 0 : Times.back()));
+}
+
+static void PrintUsage()
+{
+	printf("Benchmark [--scene Name] [--frames N] [--warmup N] [--dt Second] [--seed N] [--input Script] [--csv Path]\n");
+	printf("          [--enemies N] [--flies N] [--projectils N] [--density F] [--churn F] [--pipelined] [--fail-on-allocation]\n");
+	printf("          [--profile Frames Path]\n");
+	printf("  Run the scene headless at a fixed delta time and print the ns/frame of each engine phase\n");
+	printf("  Script is Key:StartFrame-EndFrame separate by a comma, Key is A to Z, Up, Down, Left, Right or Space\n");
+	printf("  The stress option set the spawner of SceneStress, the density is copy per 10000 square pixel and the churn is kill per second\n");
+	printf("  --pipelined run the physics of the next frame on a worker while the render\n");
+	printf("  --fail-on-allocation abort on the first allocation after the warmup, need the build with the memory tracking\n");
+	printf("  --profile save a chrome trace of the first frames after the warmup, need the build with the profiler\n");
+	printf("  Run it from the Deployment folder, the asset path are relative\n");
+}
+
+int main(int argc, char** argv)
+{
+	std::string SceneName = "SceneGame2";
+	int FrameCount = 1000;
+	int WarmupCount = 60;
+	float DeltaTime = 1.0f / 60.0f;
+	unsigned int Seed = 1;
+	std::string ScriptText = DefaultScript;
+	std::string CSVPath;
+	//Replace the param of the stress spawner prototype
+	Param StressParams;
+	bool bPipelinedFrame = false;
+	bool bFailOnAllocation = false;
+	int ProfileFrames = 0;
+	std::string ProfilePath;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string Argument = argv[i];
+		bool bHasValue = i + 1 < argc;
+		if (Argument == "--scene" && bHasValue) SceneName = argv[++i];
+		else if (Argument == "--frames" && bHasValue) FrameCount = std::atoi(argv[++i]);
+		else if (Argument == "--warmup" && bHasValue) WarmupCount = std::atoi(argv[++i]);
+		else if (Argument == "--dt" && bHasValue) DeltaTime = static_cast<float>(std::atof(argv[++i]));
+		else if (Argument == "--seed" && bHasValue) Seed = static_cast<unsigned int>(std::atoi(argv[++i]));
+		else if (Argument == "--input" && bHasValue) ScriptText = argv[++i];
+		else if (Argument == "--csv" && bHasValue) CSVPath = argv[++i];
+		else if (Argument == "--enemies" && bHasValue) StressParams["FirstEnemyCount"] = std::atoi(argv[++i]);
+		else if (Argument == "--flies" && bHasValue) StressParams["FlyEnemyCount"] = std::atoi(argv[++i]);
+		else if (Argument == "--projectils" && bHasValue) StressParams["ProjectilCount"] = std::atoi(argv[++i]);
+		else if (Argument == "--density" && bHasValue) StressParams["Density"] = static_cast<float>(std::atof(argv[++i]));
+		else if (Argument == "--churn" && bHasValue) StressParams["ChurnRate"] = static_cast<float>(std::atof(argv[++i]));
+		else if (Argument == "--pipelined") bPipelinedFrame = true;
+		else if (Argument == "--fail-on-allocation") bFailOnAllocation = true;
+		else if (Argument == "--profile" && i + 2 < argc)
+		{
+			ProfileFrames = std::atoi(argv[++i]);
+			ProfilePath = argv[++i];
+		}
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	std::vector<ScriptKey> Script;
+	if (FrameCount <= 0 || DeltaTime <= 0.0f || !ParseScript(ScriptText, &Script))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	//No window, no device, no wait, the same step each frame
+	Engine TheEngine;
+	if (!TheEngine.InitEngine("Benchmark", 1280, 960,
+		{
+			{"GraphicsBackend", EGraphicsBackend::Graphics_Null},
+			{"Headless", true},
+			{"FPS", 0},
+			{"FixedDeltaTime", DeltaTime},
+			{"PipelinedFrame", bPipelinedFrame}
+		}))
+	{
+		printf("Engine init fail\n");
+		return 1;
+	}
+
+	NullInput* Input = dynamic_cast<NullInput*>(Engine::GetInput());
+	if (!Input || !TheEngine.BeginRun())
+	{
+		printf("Engine start fail\n");
+		return 1;
+	}
+
+	InitGameplay(Seed, SceneName);
+
+	//The scene spawn the spawner in the first frame, with the param of the prototype
+	Param& StressSpawnerParams = Engine::GetInstanceManager()->GetInstanceAt("StressSpawner").InitialiseParams;
+	for (auto& [Key, Value] : StressParams)
+	{
+		StressSpawnerParams[Key] = Value;
+	}
+
+	//The scene load and the first texture load are not in the result
+	int Frame = 0;
+	for (; Frame < WarmupCount && TheEngine.GetEngineState().IsRunning; Frame++)
+	{
+		ApplyScript(Script, Frame, Input);
+		TheEngine.RunFrame();
+	}
+
+	FrameStatistics& Statistics = Engine::GetTime()->GetFrameStatistics();
+	Statistics.Reset();
+
+	//Reserve before the count, the result dont allocate in the run
+	std::vector<FrameTimes> Frames;
+	Frames.reserve(FrameCount);
+	std::vector<uint64_t> Allocations;
+	Allocations.reserve(FrameCount);
+
+	//The profiler save the trace at the end of the last capture frame
+	if (ProfileFrames > 0)
+	{
+		Profiler::RequestCapture(ProfileFrames, ProfilePath);
+	}
+
+	for (int i = 0; i < FrameCount && TheEngine.GetEngineState().IsRunning; i++, Frame++)
+	{
+		ApplyScript(Script, Frame, Input);
+
+		uint64_t AllocationStart = GetAllocationCount();
+		MemoryTracker::SetFailOnAllocation(bFailOnAllocation);
+		TheEngine.RunFrame();
+		MemoryTracker::SetFailOnAllocation(false);
+		Allocations.push_back(GetAllocationCount() - AllocationStart);
+
+		Frames.push_back(Statistics.GetLastFrame());
+	}
+
+	printf("Scene %s, %zu frames at dt %.4f s, seed %u%s\n\n", SceneName.c_str(), Frames.size(), DeltaTime, Seed, bPipelinedFrame ? ", pipelined" : "");
+	printf("%-14s %12s %12s %12s %12s %12s\n", "Phase (ns)", "Average", "P50", "P95", "P99", "Max");
+	for (uint8_t i = 0; i < FramePhase_Count; i++)
+	{
+		PrintPhase(Frames, static_cast<EFramePhase>(i));
+	}
+	PrintPhase(Frames, FramePhase_Count);
+
+	uint64_t AllocationSum = 0;
+	uint64_t AllocationMax = 0;
+	for (uint64_t Count : Allocations)
+	{
+		AllocationSum += Count;
+		AllocationMax = std::max(AllocationMax, Count);
+	}
+	printf("\nAllocation per frame: average %.2f, max %llu, total %llu\n",
+		Allocations.empty() ? 0.0 : static_cast<double>(AllocationSum) / Allocations.size(),
+		static_cast<unsigned long long>(AllocationMax), static_cast<unsigned long long>(AllocationSum));
+
+	if (MemoryTracker::IsEnabled())
+	{
+		printf("\n%-14s %12s %12s\n", "Memory (KB)", "Live", "Peak");
+		for (uint8_t i = 0; i < MemoryTag_Count; i++)
+		{
+			EMemoryTag Tag = static_cast<EMemoryTag>(i);
+			printf("%-14s %12llu %12llu\n", MemoryTracker::GetTagName(Tag),
+				static_cast<unsigned long long>(MemoryTracker::GetLiveBytes(Tag) / 1024), static_cast<unsigned long long>(MemoryTracker::GetPeakBytes(Tag) / 1024));
+		}
+		printf("%-14s %12llu %12llu\n", "Total", static_cast<unsigned long long>(MemoryTracker::GetTotalLiveBytes() / 1024),
+			static_cast<unsigned long long>(MemoryTracker::GetTotalPeakBytes() / 1024));
+	}
+
+	//The run is shorter than the capture, save what is record
+	if (Profiler::IsCapturing())
+	{
+		Profiler::EndCapture();
+		Profiler::SaveChromeTrace(ProfilePath);
+	}
+
+	if (!CSVPath.empty() && !Statistics.SaveCSV(CSVPath))
+	{
+		printf("Fail to write the CSV %s\n", CSVPath.c_str());
+	}
+
+	TheEngine.EndRun();
+	return 0;
+}
@@ -0,0 +1,312 @@
+#include "Engine.h"
+#include "AllocationCounter.h"
+#include "AI/AITBQlearning.h"
+#include "Object/Actor/Actor.h"
+#include "Object/Component/TransformComponent.h"
+#include "Object/Component/PhysicsComponent.h"
+#include "Physics/Collision/BoxCollision.h"
+#include "Physics/Collision/GridCollision.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace NPEngine;
+
+//The result are write here, the compiler cant remove the loop
+static volatile float Sink = 0.0f;
+
+//Number of run of each benchmark, the fastest is keep, the other are slow by the system
+static const int RunCount = 5;
+
+//Multiply the iteration of all the benchmark
+static uint64_t IterationScale = 1;
+
+//Run the function with the number of iteration and print is time and allocation per operation
+//The loop is in the function, the call dont count in the time
+template<typename FunctionType>
+static void RunBenchmark(const char* Name, uint64_t Iterations, FunctionType Function)
+{
+	Iterations *= IterationScale;
+
+	//First run for the cache and the lazy allocation
+	Function(Iterations / 10 + 1);
+
+	uint64_t BestNanoseconds = UINT64_MAX;
+	uint64_t Allocations = 0;
+	for (int i = 0; i < RunCount; i++)
+	{
+		uint64_t AllocationStart = GetAllocationCount();
+		auto Start = std::chrono::steady_clock::now();
+		Function(Iterations);
+		auto End = std::chrono::steady_clock::now();
+		Allocations = GetAllocationCount() - AllocationStart;
+
+		BestNanoseconds = std::min<uint64_t>(BestNanoseconds, std::chrono::duration_cast<std::chrono::nanoseconds>(End - Start).count());
+	}
+
+	double NanosecondsPerOperation = static_cast<double>(BestNanoseconds) / Iterations;
+	printf("%-36s %12llu %12.2f %14.0f %10.3f\n", Name, static_cast<unsigned long long>(Iterations), NanosecondsPerOperation,
+		NanosecondsPerOperation > 0.0 ? 1000000000.0 / NanosecondsPerOperation : 0.0, static_cast<double>(Allocations) / Iterations);
+}
+
+//Math ------------------------------------------------------------------------------
+
+static void BenchmarkVector()
+{
+	std::vector<Vector2D<float>> Vectors;
+	for (int i = 0; i < 1024; i++)
+	{
+		Vectors.push_back(Vector2D<float>(static_cast<float>(rand() % 200 - 100), static_cast<float>(rand() % 200 - 100)));
+	}
+
+	RunBenchmark("Vector2D operator + - * /", 10000000, [&Vectors](uint64_t Iterations)
+	{
+		Vector2D<float> Result = Vector2D<float>(1.0f, 1.0f);
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			Vector2D<float>& Value = Vectors[i & 1023];
+			Result = (Result + Value) * 0.5f - Value / 4.0f;
+		}
+		Sink = Result.X + Result.Y;
+	});
+
+	RunBenchmark("Vector2D::Normalize", 10000000, [&Vectors](uint64_t Iterations)
+	{
+		float Sum = 0.0f;
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			Vector2D<float> Value = Vectors[i & 1023];
+			Value.Normalize();
+			Sum += Value.X;
+		}
+		Sink = Sum;
+	});
+}
+
+//Delegate --------------------------------------------------------------------------
+
+//Object with a method to add in a delegate
+struct BenchmarkListener
+{
+public:
+	float Value = 0.0f;
+
+	void OnEvent(float Add) { Value += Add; }
+};
+
+static void BenchmarkDelegate(int ListenerCount)
+{
+	std::vector<BenchmarkListener> Listeners(ListenerCount);
+	Delegate<void, float> Event;
+	for (BenchmarkListener& Listener : Listeners)
+	{
+		Event.AddFunction(&Listener, &BenchmarkListener::OnEvent);
+	}
+
+	std::string Name = "Delegate::Broadcast " + std::to_string(ListenerCount) + " listener";
+	RunBenchmark(Name.c_str(), 10000000 / ListenerCount, [&Event](uint64_t Iterations)
+	{
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			Event.Broadcast(1.0f);
+		}
+	});
+	Sink = Listeners[0].Value;
+}
+
+//Param -----------------------------------------------------------------------------
+
+static void BenchmarkParam()
+{
+	//Same key as a actor spawn
+	Param Params =
+	{
+		{"Position", Vector2D<float>(10.0f, 20.0f)},
+		{"Size", Vector2D<float>(75.0f, 75.0f)},
+		{"DrawDepth", 2},
+		{"TexturePath", std::string("Isaac.png")},
+		{"TileSize", Vector2D<int>(48, 16)},
+		{"LoadSceneName", std::string("SceneGame1")}
+	};
+
+	RunBenchmark("Param find + std::any_cast", 10000000, [&Params](uint64_t Iterations)
+	{
+		float Sum = 0.0f;
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			auto IT = Params.find("Size");
+			if (IT != Params.end()) Sum += std::any_cast<Vector2D<float>>(IT->second).X;
+		}
+		Sink = Sum;
+	});
+}
+
+//World and collision ---------------------------------------------------------------
+
+static void BenchmarkWorld(Engine& TheEngine)
+{
+	//Actor are add at the start of the next frame
+	const int ActorCount = 1000;
+	std::vector<std::string> Names;
+	for (int i = 0; i < ActorCount; i++)
+	{
+		Names.push_back("Actor" + std::to_string(i));
+		Engine::GetWorld()->CreateActorOfClass<Actor>(Names.back(),
+		{
+			{"Position", Vector2D<float>(static_cast<float>(i % 40) * 32.0f, static_cast<float>(i / 40) * 32.0f)},
+			{"Size", Vector2D<float>(40.0f, 40.0f)}
+		});
+	}
+	TheEngine.RunFrame();
+	TheEngine.RunFrame();
+
+	Actor* FirstActor = Engine::GetWorld()->GetActorByName(Names[0]);
+	Actor* SecondActor = Engine::GetWorld()->GetActorByName(Names[1]);
+	if (!FirstActor || !SecondActor)
+	{
+		printf("Actor not create, world benchmark skip\n");
+		return;
+	}
+
+	RunBenchmark("World::GetActorByName 1000 actor", 5000000, [&Names](uint64_t Iterations)
+	{
+		size_t Found = 0;
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			if (Engine::GetWorld()->GetActorByName(Names[i % Names.size()])) Found++;
+		}
+		Sink = static_cast<float>(Found);
+	});
+
+	RunBenchmark("Actor::GetComponentOfClass found", 10000000, [FirstActor](uint64_t Iterations)
+	{
+		size_t Found = 0;
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			if (FirstActor->GetComponentOfClass<TransformComponent>()) Found++;
+		}
+		Sink = static_cast<float>(Found);
+	});
+
+	RunBenchmark("Actor::GetComponentOfClass missing", 10000000, [FirstActor](uint64_t Iterations)
+	{
+		size_t Found = 0;
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			if (FirstActor->GetComponentOfClass<PhysicsComponent>()) Found++;
+		}
+		Sink = static_cast<float>(Found);
+	});
+
+	//The two box overlap, the test go to the end
+	BoxCollision FirstBox = BoxCollision(FirstActor, nullptr);
+	BoxCollision SecondBox = BoxCollision(SecondActor, nullptr);
+	RunBenchmark("BoxCollision box test", 5000000, [&FirstBox, &SecondBox](uint64_t Iterations)
+	{
+		size_t Hit = 0;
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			if (FirstBox.CheckCollisionWithBox(SecondBox).bCollision) Hit++;
+		}
+		Sink = static_cast<float>(Hit);
+	});
+
+	//Room of the game, wall on the border
+	GridCollision Grid = GridCollision(FirstActor, nullptr);
+	std::vector<std::vector<bool>> Cells(30, std::vector<bool>(40, false));
+	for (int Y = 0; Y < 30; Y++)
+	{
+		for (int X = 0; X < 40; X++)
+		{
+			Cells[Y][X] = X == 0 || Y == 0 || X == 39 || Y == 29;
+		}
+	}
+	Grid.SetGrid(Cells);
+	Grid.SetCellSize(Vector2D<float>(32.0f, 32.0f));
+	RunBenchmark("BoxCollision grid test", 1000000, [&FirstBox, &Grid](uint64_t Iterations)
+	{
+		size_t Hit = 0;
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			if (FirstBox.CheckCollisionWithGrid(Grid).bCollision) Hit++;
+		}
+		Sink = static_cast<float>(Hit);
+	});
+}
+
+//AI --------------------------------------------------------------------------------
+
+static void BenchmarkQLearning()
+{
+	//Size of the enemy state and action
+	const int StateSize = 64;
+	const int ActionSize = 4;
+	AITBQLearning QLearning = AITBQLearning(StateSize, ActionSize, 0.1, 0.9, 0.1, 0.99, 0.1f);
+
+	RunBenchmark("AITBQLearning::GetAction", 1000000, [&QLearning](uint64_t Iterations)
+	{
+		int Sum = 0;
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			Sum += QLearning.GetAction(static_cast<int>(i % StateSize));
+		}
+		Sink = static_cast<float>(Sum);
+	});
+
+	RunBenchmark("AITBQLearning::UpdateQTable", 1000000, [&QLearning](uint64_t Iterations)
+	{
+		for (uint64_t i = 0; i < Iterations; i++)
+		{
+			int State = static_cast<int>(i % StateSize);
+			QLearning.UpdateQTable(State, static_cast<int>(i % ActionSize), (i & 1) ? 1.0 : -1.0, (State + 1) % StateSize);
+		}
+	});
+}
+
+int main(int argc, char** argv)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string Argument = argv[i];
+		if (Argument == "--scale" && i + 1 < argc)
+		{
+			IterationScale = std::max(1, std::atoi(argv[++i]));
+		}
+		else
+		{
+			printf("MicroBenchmark [--scale N]\n");
+			printf("  Print the time and the allocation of the engine primitive, --scale multiply the iteration\n");
+			return 1;
+		}
+	}
+
+	//The world and the component need the engine, no window and no device
+	Engine TheEngine;
+	if (!TheEngine.InitEngine("MicroBenchmark", 1280, 960,
+		{
+			{"GraphicsBackend", EGraphicsBackend::Graphics_Null},
+			{"Headless", true},
+			{"FPS", 0}
+		}) || !TheEngine.BeginRun())
+	{
+		printf("Engine init fail\n");
+		return 1;
+	}
+	srand(1);
+
+	printf("%-36s %12s %12s %14s %10s\n", "Benchmark", "Iterations", "ns/op", "op/s", "alloc/op");
+	BenchmarkVector();
+	BenchmarkDelegate(1);
+	BenchmarkDelegate(10);
+	BenchmarkDelegate(100);
+	BenchmarkParam();
+	BenchmarkWorld(TheEngine);
+	BenchmarkQLearning();
+
+	TheEngine.EndRun();
+	return 0;
+}
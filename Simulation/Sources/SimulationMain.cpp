@@ -0,0 +1,181 @@
+#include "Engine.h"
+#include "Gameplay.h"
+#include "Player/Isaac.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace NPEngine;
+
+//Result of one match
+enum class EMatchResult : uint8_t
+{
+	Timeout,
+	Lost,
+	Won
+};
+
+static const char* GetResultName(EMatchResult Result)
+{
+	switch (Result)
+	{
+	case EMatchResult::Lost: return "Lost";
+	case EMatchResult::Won: return "Won";
+	default: return "Timeout";
+	}
+}
+
+//Listen the end of the game on Isaac, Isaac is create again at each scene
+struct MatchListener
+{
+public:
+	EMatchResult Result = EMatchResult::Timeout;
+	bool bFinish = false;
+	//Null when the bind Isaac is destroy, the new Isaac can have the same address
+	Isaac* BindIsaac = nullptr;
+
+	void OnLose() { Result = EMatchResult::Lost; bFinish = true; }
+	void OnWin() { Result = EMatchResult::Won; bFinish = true; }
+	void OnIsaacDestroyed() { BindIsaac = nullptr; }
+
+	//Bind on the Isaac of the current scene
+	void Bind()
+	{
+		if (BindIsaac) return;
+
+		Isaac* CurrIsaac = Engine::GetWorld()->GetActorOfClass<Isaac>();
+		if (!CurrIsaac) return;
+
+		CurrIsaac->OnLose.AddFunction(this, &MatchListener::OnLose);
+		CurrIsaac->OnWin.AddFunction(this, &MatchListener::OnWin);
+		CurrIsaac->OnDestroyed.AddFunction(this, &MatchListener::OnIsaacDestroyed);
+		BindIsaac = CurrIsaac;
+	}
+};
+
+//Add the match index before the extension, the file logger clear the file at each engine start
+static std::string GetMatchLogPath(const std::string& LogPath, int MatchIndex, int MatchCount)
+{
+	if (MatchCount <= 1) return LogPath;
+
+	std::string Suffix = "_" + std::to_string(MatchIndex);
+	size_t Extension = LogPath.find_last_of('.');
+	size_t Folder = LogPath.find_last_of("/\\");
+	if (Extension == std::string::npos || (Folder != std::string::npos && Extension < Folder))
+	{
+		return LogPath + Suffix;
+	}
+	return LogPath.substr(0, Extension) + Suffix + LogPath.substr(Extension);
+}
+
+//Option of the simulation
+struct SimulationOptions
+{
+public:
+	std::string SceneName = "SceneGame1";
+	int MaxFrames = 60 * 60 * 10;
+	float DeltaTime = 1.0f / 60.0f;
+	unsigned int Seed = 1;
+	int MatchCount = 1;
+	int WorkerCount = 0;
+	std::string LogPath = "Simulation.log";
+	bool bPipelinedFrame = false;
+};
+
+//Run one match in a new engine, return false if the engine dont start
+static bool RunMatch(const SimulationOptions& Options, unsigned int Seed, int MatchIndex)
+{
+	Param EngineParams =
+	{
+		{"GraphicsBackend", EGraphicsBackend::Graphics_Null},
+		{"Headless", true},
+		{"SkipRender", true},
+		{"FPS", 0},
+		{"FixedDeltaTime", Options.DeltaTime},
+		{"PipelinedFrame", Options.bPipelinedFrame},
+		{"LogPath", GetMatchLogPath(Options.LogPath, MatchIndex, Options.MatchCount)}
+	};
+	if (Options.WorkerCount > 0)
+	{
+		EngineParams["WorkerCount"] = Options.WorkerCount;
+	}
+
+	Engine TheEngine;
+	if (!TheEngine.InitEngine("Simulation", 1280, 960, EngineParams) || !TheEngine.BeginRun())
+	{
+		printf("Engine init fail\n");
+		return false;
+	}
+
+	InitGameplay(Seed, Options.SceneName);
+
+	auto Start = std::chrono::steady_clock::now();
+
+	MatchListener Listener;
+	int Frame = 0;
+	for (; Frame < Options.MaxFrames && !Listener.bFinish && TheEngine.GetEngineState().IsRunning; Frame++)
+	{
+		TheEngine.RunFrame();
+		Listener.Bind();
+	}
+
+	auto End = std::chrono::steady_clock::now();
+	double WallMilliseconds = std::chrono::duration<double, std::milli>(End - Start).count();
+
+	printf("Match %d seed %u: %s after %d frames, %.1f s simulate in %.1f ms\n", MatchIndex, Seed, GetResultName(Listener.Result),
+		Frame, Frame * Options.DeltaTime, WallMilliseconds);
+	fflush(stdout);
+
+	TheEngine.EndRun();
+	return true;
+}
+
+static void PrintUsage()
+{
+	printf("Simulation [--scene Name] [--frames N] [--dt Second] [--seed N] [--matches N] [--workers N] [--log Path] [--pipelined]\n");
+	printf("  Run the game matches without window, render and device, the world and the physics only, one result line per match\n");
+	printf("  A match stop when Isaac lose or win, or after the frames, each match use a new engine and the next seed\n");
+	printf("  Give each process is own --log when many run in the same folder, with many matches the match index is add to the log name\n");
+	printf("  Run it from the Deployment folder, the asset path are relative\n");
+}
+
+int main(int argc, char** argv)
+{
+	SimulationOptions Options;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string Argument = argv[i];
+		bool bHasValue = i + 1 < argc;
+		if (Argument == "--scene" && bHasValue) Options.SceneName = argv[++i];
+		else if (Argument == "--frames" && bHasValue) Options.MaxFrames = std::atoi(argv[++i]);
+		else if (Argument == "--dt" && bHasValue) Options.DeltaTime = static_cast<float>(std::atof(argv[++i]));
+		else if (Argument == "--seed" && bHasValue) Options.Seed = static_cast<unsigned int>(std::atoi(argv[++i]));
+		else if (Argument == "--matches" && bHasValue) Options.MatchCount = std::atoi(argv[++i]);
+		else if (Argument == "--workers" && bHasValue) Options.WorkerCount = std::atoi(argv[++i]);
+		else if (Argument == "--log" && bHasValue) Options.LogPath = argv[++i];
+		else if (Argument == "--pipelined") Options.bPipelinedFrame = true;
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	if (Options.MaxFrames <= 0 || Options.DeltaTime <= 0.0f || Options.MatchCount <= 0)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	for (int i = 0; i < Options.MatchCount; i++)
+	{
+		if (!RunMatch(Options, Options.Seed + i, i))
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Audio/IAudioProvider.h"
+#include <functional>
 
 namespace NPEngine
 {
@@ -14,6 +15,9 @@ namespace NPEngine
 		virtual size_t LoadMusic(const std::string& Filename) = 0;
 		//Load a sound and return the id
 		virtual size_t LoadSound(const std::string& Filename) = 0;
+		//Load a sound on a worker and return the id now, play it do nothing until it is loaded
+		//OnLoaded is call on the main thread with the id and false if it fail
+		virtual size_t LoadSoundAsync(const std::string& Filename, const std::function<void(size_t, bool)>& OnLoaded = nullptr) = 0;
 
 		//Play music with a id
 		virtual void PlayMusic(size_t MusicId, int Loop = -1) = 0;
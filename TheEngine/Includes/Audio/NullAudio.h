@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Audio/IAudio.h"
+
+namespace NPEngine
+{
+	//Audio provider without sound card, nothing is load or play, for the benchmark and the test
+	class NullAudio final : public IAudio
+	{
+	public:
+		virtual ~NullAudio() = default;
+
+		virtual size_t LoadMusic(const std::string& Filename) override;
+		virtual size_t LoadSound(const std::string& Filename) override;
+		virtual size_t LoadSoundAsync(const std::string& Filename, const std::function<void(size_t, bool)>& OnLoaded = nullptr) override;
+
+		virtual void PlayMusic(size_t MusicId, int Loop) override;
+		virtual void PlaySound(size_t SoundId, int Loop) override;
+
+		virtual void PauseMusic() override;
+		virtual void StopMusic() override;
+		virtual void ResumeMusic() override;
+
+		virtual void SetMusicVolume(int Volume) override;
+		virtual void SetSoundVolume(size_t SoundId, int Volume) override;
+
+	private:
+		virtual bool Initialize(const Param& Params) override;
+		virtual void Shutdown(const Param& Params) override;
+	};
+}
@@ -2,6 +2,7 @@
 
 #include "Audio/IAudio.h"
 #include <unordered_map>
+#include <vector>
 
 struct _Mix_Music;
 struct Mix_Chunk;
@@ -14,12 +15,17 @@ namespace NPEngine
 	private:
 		std::unordered_map<size_t, _Mix_Music*> _MusicMap;
 		std::unordered_map<size_t, Mix_Chunk*> _SoundMap;
+		//Callback of the sound load on a worker, by id
+		std::unordered_map<size_t, std::vector<std::function<void(size_t, bool)>>> _PendingSounds;
+		//Volume set while the sound is in loading
+		std::unordered_map<size_t, int> _PendingVolumes;
 
 	public:
 		virtual ~SDLAudio() = default;
 
 		virtual size_t LoadMusic(const std::string& Filename) override;
 		virtual size_t LoadSound(const std::string& Filename) override;
+		virtual size_t LoadSoundAsync(const std::string& Filename, const std::function<void(size_t, bool)>& OnLoaded = nullptr) override;
 
 		virtual void PlayMusic(size_t MusicId, int Loop) override;
 		virtual void PlaySound(size_t SoundId, int Loop) override;
@@ -34,5 +40,8 @@ namespace NPEngine
 	private:
 		virtual bool Initialize(const Param& Params) override;
 		virtual void Shutdown(const Param& Params) override;
+
+		//Call on the main thread when a worker finish to decode the sound
+		void FinishSoundLoad(size_t SoundId, Mix_Chunk* Sound);
 	};
 }
\ No newline at end of file
@@ -6,11 +6,14 @@
 #include "Logger/ILogger.h"
 #include "Time/ITime.h"
 #include "Graphics/IGraphics.h"
+#include "Graphics/GraphicsEnum.h"
+#include "Graphics/FrameStatsOverlay.h"
 #include "Audio/IAudio.h"
 #include "Input/IInput.h"
 #include "World/World.h"
 #include "World/InstanceManager/IInstanceManager.h"
 #include "Physics/IPhysics.h"
+#include "Job/IJobSystem.h"
 
 namespace NPEngine
 {
@@ -50,13 +53,46 @@ namespace NPEngine
 		World* _World = nullptr;
 		IPhysicsProvider* _PhysicsProvider = nullptr;
 		IPhysics* _Physics = nullptr;
+		IJobSystemProvider* _JobSystemProvider = nullptr;
+		IJobSystem* _JobSystem = nullptr;
+		//Debug shape of the frame, draw after the world
+		DebugDraw* _DebugDraw = nullptr;
+		//Render counter on the screen, draw after the debug shape
+		FrameStatsOverlay* _FrameStatsOverlay = nullptr;
+		//F9 state of the last frame, the frame statistics are save on the press
+		bool _bSaveStatsKeyDown = false;
+		//F10 state of the last frame, the profiler capture the next frames on the press
+		bool _bProfileKeyDown = false;
+		//File and frame count of the profile capture, no capture with F10 if the path is empty
+		std::string _ProfilePath = "Profile.json";
+		int _ProfileFrames = 120;
+		//Run the physics of the next frame on a worker while the render
+		bool _bPipelinedFrame = false;
+		//Dont call the render, for the dedicated simulation
+		bool _bSkipRender = false;
 
 	public:
-		//Call for init engine
-		bool InitEngine(const char* Name, int Widht, int Height);
-		//Start the engine
+		//Call for init engine, EngineParams can have "GraphicsBackend" (EGraphicsBackend), "RenderThread" (bool), "FPS" (int, <= 0 for unlimited) and "WorkerCount" (int)
+		//The software backend also read "CaptureInterval" (int) and "CapturePath" (std::string)
+		//"StatsOverlayFont" (std::string) and "StatsOverlayFontSize" (int) show the frame stats overlay with this font
+		//"TextureBudgetMB" (int) is the texture memory before the texture without user are evict
+		//"DeltaTimeSmoothing" (float, 0 to 1) average the delta time with the last frame
+		//"FrameStatsPath" (std::string) is the start of the frame statistics CSV file name, save at the shutdown and with F9
+		//"Headless" (bool) use the null audio and input, "FixedDeltaTime" (float, second) give the same delta time each frame
+		//"PipelinedFrame" (bool) run the physics of the next frame on a worker while the render draw the saved transform
+		//"SkipRender" (bool) run only the world and the physics, "ConsoleLog" (bool) log in the console in release, "LogPath" (std::string) is the file of the file logger
+		//"ProfilePath" (std::string) is the chrome trace file save with F10, "ProfileFrames" (int) is the number of frame capture, F10 work only in the build with the profiler
+		bool InitEngine(const char* Name, int Widht, int Height, const Param& EngineParams = Param{});
+		//Start the engine, run the frame until the engine stop and shut down
 		void Start(void);
 
+		//Start to run without loop, for the tool that drive the frame itself, return false if the init fail
+		bool BeginRun();
+		//Run one frame
+		void RunFrame();
+		//Shut down after the last frame
+		void EndRun();
+
 	private:
 		//Call at start of frame
 		void StartFrame();
@@ -68,9 +104,15 @@ namespace NPEngine
 
 		//Update the physics in the world
 		void UpdatePhysics(float DeltaTime);
+		//Start the physics of the next frame on a worker, for the pipelined frame
+		void StartPhysics(float DeltaTime);
+		//Wait the physics start by StartPhysics
+		void FinishPhysics();
 
-		//Call each frame for update world
+		//Call each frame for update world, the post physics group
 		void Update(float DeltaTime);
+		//Call the update of the other tick group
+		void RunTickGroup(ETickGroup Group, float DeltaTime);
 		//Call each frame after the update
 		void PostUpdate();
 
@@ -99,5 +141,8 @@ namespace NPEngine
 		static IInstanceManager* GetInstanceManager();
 		static World* GetWorld();
 		static IPhysics* GetPhysics();
+		static IJobSystem* GetJobSystem();
+		static DebugDraw* GetDebugDraw();
+		static FrameStatsOverlay* GetFrameStatsOverlay();
 	};
 }
\ No newline at end of file
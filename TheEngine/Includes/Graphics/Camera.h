@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Math/Vector2D.h"
+#include "Math/Rectangle2D.h"
+
+namespace NPEngine
+{
+	//Data for the view of the world
+	struct Camera
+	{
+	public:
+		//World position at the top left of the viewport
+		Vector2D<float> Position = Vector2D<float>(0.0f, 0.0f);
+		float Zoom = 1.0f;
+		//Part of the window where the world is draw, a size of 0 use all the window
+		Rectangle2D<int> Viewport = Rectangle2D<int>(Vector2D<int>(0, 0), Vector2D<int>(0, 0));
+	};
+}
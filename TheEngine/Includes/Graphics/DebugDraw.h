@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Graphics/Color.h"
+#include "Math/Vector2D.h"
+#include "Math/Rectangle2D.h"
+#include <vector>
+#include <array>
+
+namespace NPEngine
+{
+	//Number of segment in a debug circle
+	constexpr int DebugCircleSegments = 32;
+
+	//One colored line, in world position
+	struct DebugLine
+	{
+	public:
+		Vector2D<float> Start = Vector2D<float>(0.0f, 0.0f);
+		Vector2D<float> End = Vector2D<float>(0.0f, 0.0f);
+		RGBA Color = RGBA();
+	};
+
+	//Immediate debug draw, all shape are keep as line and send to the graphics in one call at the end of the frame
+	class DebugDraw final
+	{
+	private:
+		//Line of the frame
+		std::vector<DebugLine> _Lines;
+
+	public:
+		//Add a line
+		void DrawLine(const Vector2D<float>& Start, const Vector2D<float>& End, const Color& Color = Color::Red);
+		//Add the 4 side of a rect
+		void DrawRect(const Rectangle2D<float>& Rect, const Color& Color = Color::Blue);
+		//Add a circle with the unit circle table
+		void DrawCircle(const Vector2D<float>& Position, float Ray, const Color& Color = Color::Red);
+		//Add a small cross
+		void DrawPoint(const Vector2D<float>& Position, const Color& Color = Color::Red);
+
+		//Send all line to the graphics and clear them, call by the engine after the world render
+		void Flush();
+
+		//Return the number of line add this frame
+		size_t GetLineCount() const { return _Lines.size(); }
+
+		//Point on the unit circle, the last is the first again
+		static const std::array<Vector2D<float>, DebugCircleSegments + 1>& GetUnitCircle();
+	};
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+
+namespace NPEngine
+{
+	//Render counter of one frame
+	struct FrameStats
+	{
+	public:
+		//Call to the renderer that draw something
+		size_t DrawCalls = 0;
+		//Texture change between two textured draw call
+		size_t TextureBinds = 0;
+		//Batch draw with at least one quad
+		size_t BatchesFlushed = 0;
+		//Textured quad record, glyph include
+		size_t QuadsSubmitted = 0;
+		//Glyph or text render with the font
+		size_t TextRasterizations = 0;
+		//Time in millisecond to present the frame
+		double PresentTime = 0.0;
+		//Number of frame in the counter, 1 for a frame
+		size_t Frames = 0;
+
+		//Add the counter of a other frame
+		void Add(const FrameStats& Other)
+		{
+			DrawCalls += Other.DrawCalls;
+			TextureBinds += Other.TextureBinds;
+			BatchesFlushed += Other.BatchesFlushed;
+			QuadsSubmitted += Other.QuadsSubmitted;
+			TextRasterizations += Other.TextRasterizations;
+			PresentTime += Other.PresentTime;
+			Frames += Other.Frames;
+		}
+	};
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Math/Vector2D.h"
+#include <string>
+#include <cstddef>
+
+namespace NPEngine
+{
+	//Draw the frame stats of the graphics on the screen, over all the other draw
+	class FrameStatsOverlay final
+	{
+	private:
+		size_t _FontId = 0;
+		bool _bVisible = false;
+		//Top left of the overlay on the screen
+		Vector2D<int> _Position = Vector2D<int>(10, 10);
+
+	public:
+		//Load the font of the overlay, return false if it fail
+		bool SetFont(const std::string& Filename, int FontSize);
+
+		//Show or hide the overlay
+		void SetVisible(bool bVisible) { _bVisible = bVisible; }
+		//Return true if the overlay is show
+		bool IsVisible() const { return _bVisible; }
+
+		//Set the top left of the overlay on the screen
+		void SetPosition(const Vector2D<int>& Position) { _Position = Position; }
+
+		//Draw the stats of the last frame, call by the engine before the present
+		void Draw();
+	};
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+//Graphics provider to create in the engine
+enum EGraphicsBackend : uint8_t
+{
+	Graphics_SDL = 0,
+	//No window and no render, for simulation
+	Graphics_Null = 1,
+	//No window, draw in a frame buffer in memory, for capture
+	Graphics_Software = 2
+};
@@ -3,8 +3,15 @@
 #include "Graphics/IGraphicsProvider.h"
 #include "Graphics/Color.h"
 #include "Graphics/Flip.h"
+#include "Graphics/Camera.h"
+#include "Graphics/DebugDraw.h"
+#include "Graphics/FrameStats.h"
+#include "Graphics/TextureResidency.h"
 #include "Math/Vector2D.h"
 #include "Math/Rectangle2D.h"
+#include <functional>
+#include <vector>
+#include <cstdint>
 
 namespace NPEngine
 {
@@ -14,6 +21,15 @@ namespace NPEngine
 	protected:
 		Color _BackgroundColor = Color();
 
+		Camera _Camera = Camera();
+		//Draw ignore the camera, for the UI
+		bool _bScreenSpace = false;
+
+		//Counter of the last frame render
+		FrameStats _FrameStats = FrameStats();
+		//Counter since the start
+		FrameStats _TotalStats = FrameStats();
+
 	public:
 		virtual ~IGraphics() = default;
 
@@ -31,15 +47,22 @@ namespace NPEngine
 		virtual void DrawPoint(const Vector2D<float>& Position, const Color& Color = Color::Red) = 0;
 		//Draw a circle
 		virtual void DrawCircle(const Vector2D<float>& Position, const float Ray, const Color& Color = Color::Red) = 0;
+		//Draw many line in one call
+		virtual void DrawLines(const DebugLine* Lines, size_t Count) = 0;
 
-		//Load a texture and return the id
+		//Load a texture and return the handle, 0 if it fail
 		virtual size_t LoadTexture(const std::string& Filename) = 0;
+		//Load a texture on a worker and return the handle now, draw with it do nothing until it is loaded
+		//OnLoaded is call on the main thread with the handle, 0 if it fail
+		virtual size_t LoadTextureAsync(const std::string& Filename, const std::function<void(size_t)>& OnLoaded = nullptr) = 0;
+		//Return true if the texture is ready to draw
+		virtual bool IsTextureLoaded(size_t TextureId) const = 0;
 		//Draw a texture with id
 		virtual void DrawTexture(size_t TextureId,
 								const Rectangle2D<float>& DrawRect,
 								const Color& Color = Color::White,
 								float Angle = 0,
-								const Flip& Flip = Flip()) = 0;
+								const Flip& Flip = NPEngine::Flip()) = 0;
 		//Draw texture tile with id
 		virtual void DrawTextureTile(size_t TextureId,
 								const Rectangle2D<float>& DrawRect,
@@ -47,7 +70,7 @@ namespace NPEngine
 								const Vector2D<int>& CellPosition,
 								const Color& Color = Color::White,
 								float Angle = 0,
-								const Flip& Flip = Flip()) = 0;
+								const Flip& Flip = NPEngine::Flip()) = 0;
 		//Draw texture tile with id in index
 		virtual void DrawTextureTile(size_t TextureId,
 								const Rectangle2D<float>& DrawRect,
@@ -55,11 +78,33 @@ namespace NPEngine
 								const int& CellIndex,
 								const Color& Color = Color::White,
 								float Angle = 0,
-								const Flip& Flip = Flip()) = 0;
+								const Flip& Flip = NPEngine::Flip()) = 0;
 		//Return the current texture size
 		virtual void GetTextureSize(size_t TextureId, Vector2D<int>* Size) = 0;
+		//Unload a texture with id
+		virtual void UnloadTexture(size_t TextureId) = 0;
+
+		//Add a user to the texture, a texture with user is never evict
+		virtual void AcquireTexture(size_t TextureId) = 0;
+		//Remove a user, without user the texture can be evict when the budget is pass and reload at the next draw
+		virtual void ReleaseTexture(size_t TextureId) = 0;
+		//Set the texture memory in byte before the texture not use since long are evict, 0 for no limit
+		virtual void SetTextureBudget(size_t Bytes) = 0;
+		//Return the state of all texture
+		virtual std::vector<TextureResidency> GetTextureResidency() const = 0;
+		//Write the state of all texture in the log, with the size and the last frame use
+		void LogTextureResidency() const;
+
+		//Create a empty texture we can draw in and return the handle
+		virtual size_t CreateRenderTexture(const Vector2D<int>& Size) = 0;
+		//All draw after go in the texture until EndDrawToTexture, the texture is clear
+		virtual bool BeginDrawToTexture(size_t TextureId) = 0;
+		//Draw back on the screen
+		virtual void EndDrawToTexture() = 0;
+		//Change when the content of all render texture is lost, like after a device reset, draw them again when it change
+		virtual uint32_t GetRenderTargetGeneration() const = 0;
 
-		//Load a font and return the id
+		//Load a font and return the handle, 0 if it fail
 		virtual size_t LoadFont(const std::string& Filename, int FontSize) = 0;
 		//Draw a text
 		virtual void DrawString(size_t FontId, const char* Text, const Vector2D<int>& Location, const Color& Color) = 0;
@@ -72,6 +117,29 @@ namespace NPEngine
 		//Return if a point is out of screen
 		virtual bool CheckPointIsOutOfScreen(const Vector2D<float>& Point) const = 0;
 
+		//Set the camera use for draw the world
+		virtual void SetCamera(const Camera& NewCamera) = 0;
+		//Return the current camera
+		const Camera& GetCamera() const { return _Camera; }
+		//Return the part of the world see by the camera
+		virtual Rectangle2D<float> GetViewRect() const = 0;
+		//If true the next draw are in screen position and ignore the camera
+		virtual void SetScreenSpace(bool bScreenSpace) = 0;
+
+		//Return the counter of the last frame render, with a render thread it is the frame before the one in record
+		const FrameStats& GetFrameStats() const { return _FrameStats; }
+		//Return the counter since the start
+		const FrameStats& GetTotalStats() const { return _TotalStats; }
+
+	protected:
+		//Set the counter of the last frame render and add it in the total
+		void PublishFrameStats(const FrameStats& Stats)
+		{
+			_FrameStats = Stats;
+			_FrameStats.Frames = 1;
+			_TotalStats.Add(_FrameStats);
+		}
+
 	private:
 		virtual bool Initialize(const Param& Params) override = 0;
 		virtual void Shutdown(const Param& Params) override = 0;
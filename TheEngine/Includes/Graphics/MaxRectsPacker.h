@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Math/Vector2D.h"
+#include "Math/Rectangle2D.h"
+#include <vector>
+
+namespace NPEngine
+{
+	//Pack rectangle in a bigger one, use the MaxRects best short side fit
+	class MaxRectsPacker
+	{
+	private:
+		Vector2D<int> _Size = Vector2D<int>(0, 0);
+		//All free space, can overlap
+		std::vector<Rectangle2D<int>> _FreeRects;
+
+	public:
+		MaxRectsPacker(const Vector2D<int>& Size);
+		virtual ~MaxRectsPacker() = default;
+
+		//Find a place for a rectangle of this size, return false if there is no place
+		bool Insert(const Vector2D<int>& Size, Rectangle2D<int>* OutRect);
+
+		//Return the packer size
+		const Vector2D<int>& GetSize() const;
+
+	private:
+		//Cut the free rect around the used rect, return true if it was cut
+		bool SplitFreeRect(const Rectangle2D<int>& FreeRect, const Rectangle2D<int>& UsedRect);
+		//Remove all free rect contain in a other
+		void PruneFreeRects();
+	};
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Graphics/IGraphics.h"
+#include "Utility/HandleTable.h"
+#include <unordered_map>
+#include <vector>
+#include <functional>
+
+struct _TTF_Font;
+
+namespace NPEngine
+{
+	//Texture size with the name it is load with
+	struct NullTextureRecord
+	{
+	public:
+		Vector2D<int> Size = Vector2D<int>(0, 0);
+		//Empty for render texture
+		std::string Name;
+		//False while a worker read the size
+		bool bLoaded = true;
+		//Number of user, only for the residency report
+		int RefCount = 0;
+		//Frame of the last draw with the texture
+		size_t LastUseFrame = 0;
+	};
+
+	//Graphics provider without window and render, only count the draw
+	class NullGraphics final : public IGraphics
+	{
+	private:
+		Vector2D<int> _ScreenSize = Vector2D<int>(800, 600);
+
+		//All texture by handle, same handle as the SDL graphics
+		HandleTable<NullTextureRecord> _Textures;
+		//Texture handle by file name, only use at load
+		std::unordered_map<std::string, size_t> _TextureHandles;
+		//Callback of the texture load on a worker, by handle
+		std::unordered_map<size_t, std::vector<std::function<void(size_t)>>> _PendingTextures;
+		//All font by handle, the font is load for the text size
+		HandleTable<_TTF_Font*> _Fonts;
+		//Font handle by file name and size, only use at load
+		std::unordered_map<std::string, size_t> _FontHandles;
+
+		//Draw of the frame in progress, each draw is a draw call
+		FrameStats _CurrentStats = FrameStats();
+		//Number of present, use for the last use of the texture
+		size_t _FrameIndex = 0;
+
+	public:
+		virtual ~NullGraphics() = default;
+
+		virtual void SetBackgroundColor(const Color& Color) override;
+		virtual void SetColor(const Color& Color) override;
+
+		virtual void DrawRect(const Rectangle2D<float>& Rect, const Color& Color, bool bFill) override;
+		virtual void DrawLine(const Vector2D<float>& Start, const Vector2D<float>& End, const Color& Color) override;
+		virtual void DrawPoint(const Vector2D<float>& Position, const Color& Color = Color::Red) override;
+		virtual void DrawCircle(const Vector2D<float>& Position, const float Ray, const Color& Color = Color::Red) override;
+		virtual void DrawLines(const DebugLine* Lines, size_t Count) override;
+
+		virtual size_t LoadTexture(const std::string& Filename) override;
+		virtual size_t LoadTextureAsync(const std::string& Filename, const std::function<void(size_t)>& OnLoaded = nullptr) override;
+		virtual bool IsTextureLoaded(size_t TextureId) const override;
+		virtual void DrawTexture(size_t TextureId, const Rectangle2D<float>& DrawRect, const Color& Color, float Angle, const Flip& Flip) override;
+		virtual void DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const Vector2D<int>& CellPosition, const Color& Color, float Angle, const Flip& Flip) override;
+		virtual void DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const int& CellIndex, const Color& Color = Color::White, float Angle = 0, const Flip& Flip = NPEngine::Flip()) override;
+		virtual void GetTextureSize(size_t TextureId, Vector2D<int>* Size) override;
+		virtual void UnloadTexture(size_t TextureId) override;
+
+		virtual void AcquireTexture(size_t TextureId) override;
+		virtual void ReleaseTexture(size_t TextureId) override;
+		virtual void SetTextureBudget(size_t Bytes) override;
+		virtual std::vector<TextureResidency> GetTextureResidency() const override;
+
+		virtual size_t CreateRenderTexture(const Vector2D<int>& Size) override;
+		virtual bool BeginDrawToTexture(size_t TextureId) override;
+		virtual void EndDrawToTexture() override;
+		virtual uint32_t GetRenderTargetGeneration() const override { return 0; }
+
+		virtual size_t LoadFont(const std::string& Filename, int FontSize) override;
+		virtual void DrawString(size_t FontId, const char* Text, const Vector2D<int>& Location, const Color& Color) override;
+		virtual void GetTextSize(size_t FontId, const char* Text, Vector2D<int>* Size) override;
+
+		virtual Vector2D<int> GetScreenSize() const override;
+
+		virtual bool CheckPointIsOutOfScreen(const Vector2D<float>& Point) const override;
+
+		virtual void SetCamera(const Camera& NewCamera) override;
+		virtual Rectangle2D<float> GetViewRect() const override;
+		virtual void SetScreenSpace(bool bScreenSpace) override;
+
+	private:
+		virtual bool Initialize(const Param& Params) override;
+		virtual void Shutdown(const Param& Params) override;
+
+		virtual void Clear() override;
+		virtual void Present() override;
+
+		//Read the image size in the png header
+		static bool ReadImageSize(const std::string& FilePath, Vector2D<int>* Size);
+		//Read the texture size, load the image if it is not a png, can be call on a worker
+		static bool ReadTextureSize(const std::string& Filename, Vector2D<int>* Size);
+		//Return the texture record, nullptr if not loaded
+		const NullTextureRecord* GetLoadedTexture(size_t TextureId) const;
+		//Save the frame of a draw with the texture, return false if not loaded
+		bool UseTexture(size_t TextureId);
+	};
+}
@@ -1,15 +1,170 @@
 #pragma once
 
 #include "Graphics/IGraphics.h"
+#include "Graphics/MaxRectsPacker.h"
+#include "Utility/HandleTable.h"
 #include <unordered_map>
+#include <vector>
+#include <string>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 
 struct SDL_Renderer;
 struct SDL_Window;
 struct SDL_Texture;
+struct SDL_Surface;
+union SDL_Event;
 struct _TTF_Font;
 
 namespace NPEngine
 {
+	//Loaded texture with is size, can be a part of a atlas page
+	struct TextureData
+	{
+	public:
+		SDL_Texture* Texture = nullptr;
+		Vector2D<int> Size = Vector2D<int>(0, 0);
+		//Position of the texture in the SDL texture
+		Vector2D<int> Offset = Vector2D<int>(0, 0);
+		//Size of the SDL texture
+		Vector2D<int> TextureSize = Vector2D<int>(0, 0);
+		//The SDL texture is a atlas page, shared with other texture
+		bool bInAtlas = false;
+	};
+
+	//Texture in the handle table with the name it is load with
+	struct TextureRecord
+	{
+	public:
+		TextureData Data = TextureData();
+		//Empty for render texture
+		std::string Name;
+		//Number of user, the texture is evict only without user
+		int RefCount = 0;
+		//Frame of the last draw with the texture
+		size_t LastUseFrame = 0;
+		//The SDL texture is destroy to stay in the budget, it is reload at the next use
+		bool bEvicted = false;
+		//Index of the atlas page of the texture, -1 if it is not in a page
+		int AtlasPage = -1;
+	};
+
+	//Big texture with many small texture pack in
+	struct AtlasPage
+	{
+	public:
+		AtlasPage(SDL_Texture* Texture, const Vector2D<int>& Size) : Texture(Texture), Packer(Size) {}
+
+		SDL_Texture* Texture = nullptr;
+		MaxRectsPacker Packer;
+		//Number of texture in the page, the page is free when it is 0
+		int TextureCount = 0;
+	};
+
+	//One glyph render in a font page
+	struct GlyphData
+	{
+	public:
+		int Page = -1;
+		Rectangle2D<int> Rect = Rectangle2D<int>(Vector2D<int>(0, 0), Vector2D<int>(0, 0));
+		int Advance = 0;
+	};
+
+	//One glyph place in a text
+	struct TextGlyph
+	{
+	public:
+		int Page = -1;
+		Rectangle2D<int> Rect = Rectangle2D<int>(Vector2D<int>(0, 0), Vector2D<int>(0, 0));
+		//Position from the text location
+		Vector2D<int> Offset = Vector2D<int>(0, 0);
+	};
+
+	//Text with all glyph already place
+	struct TextLayout
+	{
+	public:
+		std::string Text;
+		std::vector<TextGlyph> Glyphs;
+		Vector2D<int> Size = Vector2D<int>(0, 0);
+	};
+
+	//Font at one size with is glyph atlas
+	struct FontData
+	{
+	public:
+		_TTF_Font* Font = nullptr;
+		//Page with all glyph render
+		std::vector<AtlasPage> Pages;
+		std::unordered_map<unsigned int, GlyphData> Glyphs;
+		//Text layout by text hash
+		std::unordered_map<size_t, TextLayout> Layouts;
+	};
+
+	//All draw command type
+	enum EDrawCommandType : uint8_t
+	{
+		DrawCommand_Quad = 0,
+		DrawCommand_Rect = 1,
+		DrawCommand_Line = 2,
+		DrawCommand_Point = 3,
+		DrawCommand_Circle = 4,
+		DrawCommand_SetTarget = 5,
+		DrawCommand_SetClip = 6,
+		DrawCommand_Clear = 7,
+		DrawCommand_DestroyTexture = 8,
+		DrawCommand_Present = 9,
+		DrawCommand_Lines = 10
+	};
+
+	//One draw record during the frame, all position are already in screen
+	struct DrawCommand
+	{
+	public:
+		EDrawCommandType Type = EDrawCommandType::DrawCommand_Quad;
+		//Texture for quad, target and destroy
+		TextureData Texture = TextureData();
+		//Draw rect, for line Position is the start and Size the end, for circle Position is the center and Size.X the ray
+		Rectangle2D<float> Rect = Rectangle2D<float>(Vector2D<float>(0.0f, 0.0f), Vector2D<float>(0.0f, 0.0f));
+		//Texture rect for quad, clip rect for clip, for lines Position.X is the first line and Size.X the count
+		Rectangle2D<int> SourceRect = Rectangle2D<int>(Vector2D<int>(0, 0), Vector2D<int>(0, 0));
+		RGBA Color = RGBA();
+		float Angle = 0.0f;
+		Flip TextureFlip = Flip();
+		//Fill for rect, enable for clip
+		bool bFlag = false;
+	};
+
+	//Function to call on the render thread
+	struct RenderTask
+	{
+	public:
+		std::function<void()> Function;
+		bool* bDone = nullptr;
+	};
+
+	//Vertex send to the renderer in a batch
+	struct BatchVertex
+	{
+	public:
+		Vector2D<float> Position = Vector2D<float>(0.0f, 0.0f);
+		RGBA Color = RGBA();
+		Vector2D<float> UV = Vector2D<float>(0.0f, 0.0f);
+	};
+
+	//All quad with the same texture draw in one call
+	struct BatchRun
+	{
+	public:
+		SDL_Texture* Texture = nullptr;
+		Rectangle2D<float> Bounds = Rectangle2D<float>(Vector2D<float>(0.0f, 0.0f), Vector2D<float>(0.0f, 0.0f));
+		std::vector<BatchVertex> Vertices;
+	};
+
 	//Graphics provider with SDL
 	class SDLGraphics final : public IGraphics
 	{
@@ -19,10 +174,77 @@ namespace NPEngine
 		SDL_Renderer* _Renderer = nullptr;
 		SDL_Window* _Window = nullptr;
 
-		//All texture id Map
-		std::unordered_map<size_t, SDL_Texture*> _TextureMap;
-		//All font id map
-		std::unordered_map<size_t, _TTF_Font*> _FontMap;
+		//All texture by handle
+		HandleTable<TextureRecord> _Textures;
+		//Texture handle by file name, only use at load
+		std::unordered_map<std::string, size_t> _TextureHandles;
+		//Callback of the texture load on a worker, by handle
+		std::unordered_map<size_t, std::vector<std::function<void(size_t)>>> _PendingTextures;
+		//All font by handle, one per file and size
+		HandleTable<FontData> _Fonts;
+		//Font handle by file name and size, only use at load
+		std::unordered_map<std::string, size_t> _FontHandles;
+
+		//All run waiting to be flush, only the _BatchRunCount first are used
+		std::vector<BatchRun> _BatchRuns;
+		size_t _BatchRunCount = 0;
+		//Index buffer shared by all run
+		std::vector<int> _BatchIndices;
+
+		//All atlas page
+		std::vector<AtlasPage> _AtlasPages;
+		//Size of a atlas page
+		const int _AtlasPageSize = 2048;
+		//Texture bigger than that have there own texture
+		const int _AtlasMaxTextureSize = 1024;
+		//Space between two texture in a page
+		const int _AtlasPadding = 1;
+
+		//Texture memory before the texture without user are evict, 0 for no limit
+		size_t _TextureBudget = 0;
+		//Number of present, use for the last use of the texture
+		size_t _FrameIndex = 0;
+
+		//True when draw in a render texture, the camera is not use
+		bool _bDrawToTexture = false;
+		//Add one at each reset of the render target, the event can come from the render thread
+		std::atomic<uint32_t> _RenderTargetGeneration = 0;
+
+		//Color set with SetColor
+		Color _DrawColor = Color();
+
+		//Command list, one record by the game while the other is render
+		std::vector<DrawCommand> _CommandLists[2];
+		int _RecordListIndex = 0;
+		//Line of the lines command, one per command list
+		std::vector<DebugLine> _LineLists[2];
+		//Counter of each command list, the record side count first then the render side
+		FrameStats _ListStats[2];
+		//Vertex of the line draw, two triangle per line
+		std::vector<BatchVertex> _LineVertices;
+		//Counter of the list in render, only use on the render side
+		FrameStats* _ExecuteStats = nullptr;
+		//Texture of the last geometry call, for count the texture bind
+		SDL_Texture* _BoundTexture = nullptr;
+
+		//Render thread, own the SDL renderer
+		bool _bUseRenderThread = false;
+		std::thread _RenderThread;
+		std::thread::id _RenderThreadId;
+		std::mutex _RenderMutex;
+		std::condition_variable _RenderCondition;
+		//List send to the render thread, nullptr when it is done
+		std::vector<DrawCommand>* _SubmitList = nullptr;
+		std::vector<DebugLine>* _SubmitLines = nullptr;
+		FrameStats* _SubmitStats = nullptr;
+		//Task like texture load to call on the render thread
+		std::deque<RenderTask> _RenderTasks;
+		bool _bStopRenderThread = false;
+
+		//Size of a glyph page
+		const int _GlyphPageSize = 512;
+		//Number of text layout keep per font before clear
+		const size_t _MaxTextLayout = 256;
 
 	public:
 		virtual ~SDLGraphics() = default;
@@ -38,11 +260,26 @@ namespace NPEngine
 
 		virtual void DrawCircle(const Vector2D<float>& Position, const float Ray, const Color& Color = Color::Red) override;
 
+		virtual void DrawLines(const DebugLine* Lines, size_t Count) override;
+
 		virtual size_t LoadTexture(const std::string& Filename) override;
+		virtual size_t LoadTextureAsync(const std::string& Filename, const std::function<void(size_t)>& OnLoaded = nullptr) override;
+		virtual bool IsTextureLoaded(size_t TextureId) const override;
 		virtual void DrawTexture(size_t TextureId, const Rectangle2D<float>& DrawRect, const Color& Color, float Angle, const Flip& Flip) override;
 		virtual void DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const Vector2D<int>& CellPosition, const Color& Color, float Angle, const Flip& Flip) override;
-		virtual void DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const int& CellIndex, const Color& Color = Color::White, float Angle = 0, const Flip& Flip = Flip()) override;
+		virtual void DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const int& CellIndex, const Color& Color = Color::White, float Angle = 0, const Flip& Flip = NPEngine::Flip()) override;
 		virtual void GetTextureSize(size_t TextureId, Vector2D<int>* Size) override;
+		virtual void UnloadTexture(size_t TextureId) override;
+
+		virtual void AcquireTexture(size_t TextureId) override;
+		virtual void ReleaseTexture(size_t TextureId) override;
+		virtual void SetTextureBudget(size_t Bytes) override;
+		virtual std::vector<TextureResidency> GetTextureResidency() const override;
+
+		virtual size_t CreateRenderTexture(const Vector2D<int>& Size) override;
+		virtual bool BeginDrawToTexture(size_t TextureId) override;
+		virtual void EndDrawToTexture() override;
+		virtual uint32_t GetRenderTargetGeneration() const override { return _RenderTargetGeneration.load(std::memory_order_acquire); }
 
 		virtual size_t LoadFont(const std::string& Filename, int FontSize) override;
 		virtual void DrawString(size_t FontId, const char* Text, const Vector2D<int>& Location, const Color& Color) override;
@@ -52,6 +289,10 @@ namespace NPEngine
 
 		virtual bool CheckPointIsOutOfScreen(const Vector2D<float>& Point) const override;
 
+		virtual void SetCamera(const Camera& NewCamera) override;
+		virtual Rectangle2D<float> GetViewRect() const override;
+		virtual void SetScreenSpace(bool bScreenSpace) override;
+
 	private:
 		virtual bool Initialize(const Param& Params) override;
 		virtual void Shutdown(const Param& Params) override;
@@ -59,5 +300,75 @@ namespace NPEngine
 		virtual void Clear() override;
 		virtual void Present() override;
 
+		//Event watch of SDL, count the reset of the render target
+		static int OnRenderEvent(void* UserData, SDL_Event* Event);
+
+		//Load the image file in a RGBA surface, can be call on a worker
+		static SDL_Surface* LoadSurface(const std::string& Filename);
+		//Create the texture of the surface, in a atlas page or alone, OutAtlasPage is -1 if it is alone
+		bool CreateTextureData(SDL_Surface* Surface, TextureData* OutData, int* OutAtlasPage);
+		//Call on the main thread when a worker finish to load the surface
+		void FinishTextureLoad(size_t TextureId, SDL_Surface* Surface);
+		//Put the surface in a atlas page, return false if it is too big
+		bool AddToAtlas(SDL_Surface* Surface, TextureData* OutData, int* OutAtlasPage);
+		//Destroy the texture of the page after the command already record, the empty page is reuse by the next new page
+		void FreeAtlasPage(int PageIndex);
+		//Load again a evict texture on a worker
+		void ReloadTexture(size_t TextureId);
+		//Evict the texture without user in LRU order until the memory is in the budget
+		//A atlas page is evict with all its texture when none of them have user or is draw this frame
+		void EvictTextures();
+		//Return the memory of the texture, 0 for a texture in a atlas page
+		static size_t GetTextureBytes(const TextureData& Texture);
+
+		//Return the viewport, all the window if the camera viewport is empty
+		Rectangle2D<int> GetViewport() const;
+		//Return true if the draw use the camera
+		bool UseCamera() const;
+		//Change a world position in screen position
+		Vector2D<float> WorldToScreen(const Vector2D<float>& Position) const;
+		//Change a world rect in screen rect
+		Rectangle2D<float> WorldToScreen(const Rectangle2D<float>& Rect) const;
+
+		//Return the glyph, render it in a font page the first time
+		const GlyphData* GetGlyph(FontData& Font, unsigned int Character);
+		//Return the text layout, create it the first time
+		const TextLayout* GetTextLayout(size_t FontId, const char* Text);
+
+		//Return the texture data at id, nullptr if not loaded
+		const TextureData* GetTextureData(size_t TextureId) const;
+		//Return the texture data at id for a draw, save the frame and reload the texture if it is evict
+		const TextureData* UseTextureData(size_t TextureId);
+
+		//Record a textured quad in the current command list
+		void RecordQuad(const TextureData& Texture, const Rectangle2D<float>& WorldRect, const Rectangle2D<int>& SourceRect, const Color& Color, float Angle, const Flip& Flip);
+		//Return the command list the game record in
+		std::vector<DrawCommand>& GetRecordList() { return _CommandLists[_RecordListIndex]; }
+		//Return the line list of the command list the game record in
+		std::vector<DebugLine>& GetRecordLines() { return _LineLists[_RecordListIndex]; }
+		//Return the counter of the command list the game record in
+		FrameStats& GetRecordStats() { return _ListStats[_RecordListIndex]; }
+		//Call the function on the render thread and wait, call it now without render thread
+		void RunOnRenderThread(const std::function<void()>& Function);
+		//Loop of the render thread
+		void RenderThreadLoop();
+		//Finish the render thread work and wait for it
+		void StopRenderThread();
+		//Destroy all SDL texture and the renderer
+		void ReleaseRenderResources();
+
+		//Render side ----------
+		//Do all command of the list with the SDL renderer, the render counter are add in Stats
+		void ExecuteCommands(const std::vector<DrawCommand>& Commands, const std::vector<DebugLine>& Lines, FrameStats& Stats);
+		//Add a textured quad in the batch
+		void PushQuad(const DrawCommand& Command);
+		//Return the run to use for a quad with this texture and bounds
+		BatchRun& GetBatchRun(SDL_Texture* Texture, const Rectangle2D<float>& Bounds);
+		//Draw all quad in the batch, one call per run
+		void FlushBatch();
+		//Grow the shared index buffer for this number of quad
+		void GrowBatchIndices(size_t QuadCount);
+		//Draw the lines with one geometry call, each line is a quad one pixel wide
+		void DrawLineBatch(const std::vector<DebugLine>& Lines, size_t First, size_t Count);
 	};
-}
\ No newline at end of file
+}
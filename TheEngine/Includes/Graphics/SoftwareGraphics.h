@@ -0,0 +1,173 @@
+#pragma once
+
+#include "Graphics/IGraphics.h"
+#include "Utility/HandleTable.h"
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+struct _TTF_Font;
+
+namespace NPEngine
+{
+	//Texture pixel in memory, 4 byte per pixel in R, G, B, A order
+	struct SoftwareTexture
+	{
+	public:
+		Vector2D<int> Size = Vector2D<int>(0, 0);
+		std::vector<uint32_t> Pixels;
+		//Empty for render texture
+		std::string Name;
+		//False while a worker load the pixel
+		bool bLoaded = true;
+		//Number of user, the texture is evict only without user
+		int RefCount = 0;
+		//Frame of the last draw with the texture
+		size_t LastUseFrame = 0;
+		//The pixel are free to stay in the budget, they are load again at the next use
+		bool bEvicted = false;
+	};
+
+	//Font with the text already render
+	struct SoftwareFont
+	{
+	public:
+		_TTF_Font* Font = nullptr;
+		//White text by string
+		std::unordered_map<std::string, SoftwareTexture> Texts;
+	};
+
+	//Graphics provider without GPU, all draw are blend in a frame buffer in memory
+	class SoftwareGraphics final : public IGraphics
+	{
+	private:
+		Vector2D<int> _ScreenSize = Vector2D<int>(800, 600);
+		std::vector<uint32_t> _FrameBuffer;
+
+		//All texture by handle
+		HandleTable<SoftwareTexture> _Textures;
+		//Texture handle by file name, only use at load
+		std::unordered_map<std::string, size_t> _TextureHandles;
+		//Callback of the texture load on a worker, by handle
+		std::unordered_map<size_t, std::vector<std::function<void(size_t)>>> _PendingTextures;
+		//All font by handle
+		HandleTable<SoftwareFont> _Fonts;
+		//Font handle by file name and size, only use at load
+		std::unordered_map<std::string, size_t> _FontHandles;
+		//Number of text keep per font before clear
+		const size_t _MaxFontText = 256;
+
+		//Pixel the draw go in, the frame buffer or a render texture
+		uint32_t* _TargetPixels = nullptr;
+		Vector2D<int> _TargetSize = Vector2D<int>(0, 0);
+		//Draw outside are cut
+		Rectangle2D<int> _ClipRect = Rectangle2D<int>(Vector2D<int>(0, 0), Vector2D<int>(0, 0));
+		//True when draw in a render texture, the camera is not use
+		bool _bDrawToTexture = false;
+
+		//Source pixel of the row in draw
+		std::vector<uint32_t> _RowBuffer;
+		//Source column of each pixel in the row
+		std::vector<int> _ColumnBuffer;
+
+		//Draw of the frame in progress, each blit is a quad
+		FrameStats _CurrentStats = FrameStats();
+		//Texture of the last blit, for count the texture change
+		const SoftwareTexture* _BoundTexture = nullptr;
+
+		//Texture memory before the texture without user are evict, 0 for no limit
+		size_t _TextureBudget = 0;
+
+		//Save the frame buffer each CaptureInterval present, 0 for never
+		int _CaptureInterval = 0;
+		std::string _CapturePath;
+		size_t _FrameCount = 0;
+
+	public:
+		virtual ~SoftwareGraphics() = default;
+
+		virtual void SetBackgroundColor(const Color& Color) override;
+		virtual void SetColor(const Color& Color) override;
+
+		virtual void DrawRect(const Rectangle2D<float>& Rect, const Color& Color, bool bFill) override;
+		virtual void DrawLine(const Vector2D<float>& Start, const Vector2D<float>& End, const Color& Color) override;
+		virtual void DrawPoint(const Vector2D<float>& Position, const Color& Color = Color::Red) override;
+		virtual void DrawCircle(const Vector2D<float>& Position, const float Ray, const Color& Color = Color::Red) override;
+		virtual void DrawLines(const DebugLine* Lines, size_t Count) override;
+
+		virtual size_t LoadTexture(const std::string& Filename) override;
+		virtual size_t LoadTextureAsync(const std::string& Filename, const std::function<void(size_t)>& OnLoaded = nullptr) override;
+		virtual bool IsTextureLoaded(size_t TextureId) const override;
+		virtual void DrawTexture(size_t TextureId, const Rectangle2D<float>& DrawRect, const Color& Color, float Angle, const Flip& Flip) override;
+		virtual void DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const Vector2D<int>& CellPosition, const Color& Color, float Angle, const Flip& Flip) override;
+		virtual void DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const int& CellIndex, const Color& Color = Color::White, float Angle = 0, const Flip& Flip = NPEngine::Flip()) override;
+		virtual void GetTextureSize(size_t TextureId, Vector2D<int>* Size) override;
+		virtual void UnloadTexture(size_t TextureId) override;
+
+		virtual void AcquireTexture(size_t TextureId) override;
+		virtual void ReleaseTexture(size_t TextureId) override;
+		virtual void SetTextureBudget(size_t Bytes) override;
+		virtual std::vector<TextureResidency> GetTextureResidency() const override;
+
+		virtual size_t CreateRenderTexture(const Vector2D<int>& Size) override;
+		virtual bool BeginDrawToTexture(size_t TextureId) override;
+		virtual void EndDrawToTexture() override;
+		virtual uint32_t GetRenderTargetGeneration() const override { return 0; }
+
+		virtual size_t LoadFont(const std::string& Filename, int FontSize) override;
+		virtual void DrawString(size_t FontId, const char* Text, const Vector2D<int>& Location, const Color& Color) override;
+		virtual void GetTextSize(size_t FontId, const char* Text, Vector2D<int>* Size) override;
+
+		virtual Vector2D<int> GetScreenSize() const override;
+
+		virtual bool CheckPointIsOutOfScreen(const Vector2D<float>& Point) const override;
+
+		virtual void SetCamera(const Camera& NewCamera) override;
+		virtual Rectangle2D<float> GetViewRect() const override;
+		virtual void SetScreenSpace(bool bScreenSpace) override;
+
+		//Return the frame buffer pixel, row by row in R, G, B, A order
+		const std::vector<uint32_t>& GetFrameBuffer() const { return _FrameBuffer; }
+		//Save the frame buffer in a png file, return false if it fail
+		bool SavePNG(const std::string& FilePath) const;
+
+	private:
+		virtual bool Initialize(const Param& Params) override;
+		virtual void Shutdown(const Param& Params) override;
+
+		virtual void Clear() override;
+		virtual void Present() override;
+
+		//Load the image file in RGBA pixel, can be call on a worker
+		static bool LoadPixels(const std::string& Filename, SoftwareTexture* OutTexture);
+		//Return the texture, nullptr if not loaded
+		const SoftwareTexture* GetLoadedTexture(size_t TextureId) const;
+		//Return the texture for a draw, save the frame and load again the pixel if it is evict
+		const SoftwareTexture* UseTexture(size_t TextureId);
+		//Load again the pixel of a evict texture now, the capture stay the same with or without budget
+		bool ReloadTexture(SoftwareTexture& Texture);
+		//Free the pixel of the texture without user in LRU order until the memory is in the budget
+		void EvictTextures();
+
+		//Return the viewport, all the screen if the camera viewport is empty
+		Rectangle2D<int> GetViewport() const;
+		//Return true if the draw use the camera
+		bool UseCamera() const;
+		//Change a world position in screen position
+		Vector2D<float> WorldToScreen(const Vector2D<float>& Position) const;
+		//Change a world rect in screen rect
+		Rectangle2D<float> WorldToScreen(const Rectangle2D<float>& Rect) const;
+		//Draw in the pixel, clip to the viewport or to all the texture
+		void SetTarget(uint32_t* Pixels, const Vector2D<int>& Size);
+		//Clip the draw to the camera viewport
+		void UpdateClipRect();
+
+		//Blend a rect of one color, in screen position
+		void FillRect(int X0, int Y0, int X1, int Y1, const RGBA& Color);
+		//Blend a line one pixel wide, in screen position
+		void DrawScreenLine(const Vector2D<float>& Start, const Vector2D<float>& End, const RGBA& Color);
+		//Blend a part of the texture in the screen rect, with flip, rotation and color
+		void BlitTexture(const SoftwareTexture& Texture, const Rectangle2D<int>& SourceRect, const Rectangle2D<float>& ScreenRect, const RGBA& Color, float Angle, const Flip& Flip);
+	};
+}
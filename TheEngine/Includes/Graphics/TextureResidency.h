@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Math/Vector2D.h"
+#include <string>
+#include <cstddef>
+
+namespace NPEngine
+{
+	//State of one texture in the texture cache, for the residency report
+	struct TextureResidency
+	{
+	public:
+		size_t TextureId = 0;
+		//Empty for render texture
+		std::string Name;
+		Vector2D<int> Size = Vector2D<int>(0, 0);
+		//Memory of the texture, 0 for a texture in a atlas page
+		size_t Bytes = 0;
+		//Number of scene or actor that use the texture, evict only at 0
+		int RefCount = 0;
+		//Frame of the last draw with the texture
+		size_t LastUseFrame = 0;
+		//False when the texture is evict, it is reload at the next draw
+		bool bResident = true;
+		bool bInAtlas = false;
+	};
+}
@@ -57,6 +57,12 @@ namespace NPEngine
 		//Return the current mouse position
 		virtual Vector2D<int> GetMousePosition() = 0;
 
+	protected:
+		//Create the delegate and the state of all key and button
+		void InitialiseInputData();
+		//Update the key and button state with IsKeyDown and IsButtonDown, and call the delegate of the change
+		void BroadcastInputChange(float DeltaTime);
+
 	private:
 		virtual bool Initialize(const Param& Params) override = 0;
 		virtual void Shutdown(const Param& Params) override = 0;
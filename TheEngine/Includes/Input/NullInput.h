@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Input/IInput.h"
+
+namespace NPEngine
+{
+	//Input provider without device, the key are set by the code, for the benchmark and the test
+	class NullInput final : public IInput
+	{
+	private:
+		bool _KeyStates[EKeyboardKeys::Key_Max] = {};
+		bool _ButtonStates[EButtonKeys::Mouse_Max] = {};
+		Vector2D<int> _MousePosition = Vector2D<int>(0, 0);
+
+	public:
+		virtual ~NullInput() = default;
+
+		virtual bool IsKeyDown(EKeyboardKeys Key) override;
+		virtual bool IsButtonDown(EButtonKeys Key) override;
+
+		virtual void GetMousePosition(int* X, int* Y) override;
+		virtual Vector2D<int> GetMousePosition() override;
+
+		//Set the key state, the delegate are call at the next frame
+		void SetKeyDown(EKeyboardKeys Key, bool bIsDown);
+		//Set the button state, the delegate are call at the next frame
+		void SetButtonDown(EButtonKeys Key, bool bIsDown);
+		//Set the mouse position
+		void SetMousePosition(const Vector2D<int>& Position) { _MousePosition = Position; }
+		//Release all key and button
+		void ReleaseAll();
+
+	private:
+		virtual bool Initialize(const Param& Params) override;
+		virtual void Shutdown(const Param& Params) override;
+
+		virtual void ProcessInput() override;
+		virtual void UpdateInputListener(float DeltaTime) override;
+	};
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Job/IJobSystemProvider.h"
+#include "Job/JobHandle.h"
+#include <functional>
+
+namespace NPEngine
+{
+	//Interface for a job system, run job on worker thread
+	class IJobSystem : public IJobSystemProvider
+	{
+	public:
+		virtual ~IJobSystem() = default;
+
+		//Run the job on a worker thread, OnComplete is call on the main thread after it
+		virtual JobHandle AddJob(const std::function<void()>& Job, const std::function<void()>& OnComplete = nullptr) = 0;
+		//Call the function on the main thread at the next frame start
+		virtual void AddMainThreadJob(const std::function<void()>& Job) = 0;
+		//Wait the job, the waiting thread help to run the other job
+		//bCompleteMainThreadJobs false dont call the completion on the main thread, for wait a job without completion that read data a completion can change
+		//A job with a completion can only be wait on the main thread with bCompleteMainThreadJobs, else it log and return before the job is done
+		virtual void Wait(const JobHandle& Handle, bool bCompleteMainThreadJobs = true) = 0;
+
+		//Return the number of worker thread
+		virtual int GetWorkerCount() const = 0;
+		//Return true if call on the main thread
+		virtual bool IsMainThread() const = 0;
+
+	private:
+		virtual bool Initialize(const Param& Params = Param{}) override = 0;
+		virtual void Shutdown(const Param& Params = Param{}) override = 0;
+
+		virtual void ProcessMainThreadJobs() override = 0;
+	};
+}
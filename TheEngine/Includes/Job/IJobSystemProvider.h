@@ -0,0 +1,21 @@
+#pragma once
+
+#include "IServiceProvider.h"
+
+namespace NPEngine
+{
+	//Interface for job system provider friend with engine class
+	class IJobSystemProvider : public IServiceProvider
+	{
+		friend class Engine;
+	public:
+		virtual ~IJobSystemProvider() = default;
+
+	private:
+		virtual bool Initialize(const Param& Params = Param{}) override = 0;
+		virtual void Shutdown(const Param& Params = Param{}) override = 0;
+
+		//Call on the main thread each frame, call all completion ready
+		virtual void ProcessMainThreadJobs() = 0;
+	};
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+#include <atomic>
+
+namespace NPEngine
+{
+	//Handle on a job add in the job system, done when the job and is completion are call
+	class JobHandle
+	{
+		friend class JobSystem;
+	private:
+		std::shared_ptr<std::atomic<bool>> _bDone;
+		//The job is done only after the completion is call on the main thread
+		bool _bHasCompletion = false;
+
+	public:
+		JobHandle() = default;
+
+		//Return true if the handle is on a job
+		bool IsValid() const { return _bDone != nullptr; }
+		//Return true if the job is finish, a handle not valid is always done
+		bool IsDone() const { return !_bDone || _bDone->load(std::memory_order_acquire); }
+		//Return true if the job have a completion
+		bool HasCompletion() const { return _bHasCompletion; }
+	};
+}
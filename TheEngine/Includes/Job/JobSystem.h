@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Job/IJobSystem.h"
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace NPEngine
+{
+	//One job wait in a queue
+	struct JobEntry
+	{
+	public:
+		std::function<void()> Function;
+		//Call on the main thread after the function
+		std::function<void()> OnComplete;
+		std::shared_ptr<std::atomic<bool>> bDone;
+	};
+
+	//Job system with a pool of worker thread
+	class JobSystem final : public IJobSystem
+	{
+	private:
+		std::vector<std::thread> _Workers;
+		std::thread::id _MainThreadId;
+
+		//Job wait for a worker
+		std::deque<JobEntry> _Jobs;
+		std::mutex _JobMutex;
+		std::condition_variable _JobCondition;
+		bool _bStop = false;
+
+		//Completion wait for the main thread
+		std::vector<JobEntry> _MainThreadJobs;
+		std::mutex _MainThreadMutex;
+
+	public:
+		virtual ~JobSystem() = default;
+
+		virtual JobHandle AddJob(const std::function<void()>& Job, const std::function<void()>& OnComplete = nullptr) override;
+		virtual void AddMainThreadJob(const std::function<void()>& Job) override;
+		virtual void Wait(const JobHandle& Handle, bool bCompleteMainThreadJobs = true) override;
+
+		virtual int GetWorkerCount() const override;
+		virtual bool IsMainThread() const override;
+
+	private:
+		virtual bool Initialize(const Param& Params) override;
+		virtual void Shutdown(const Param& Params) override;
+
+		virtual void ProcessMainThreadJobs() override;
+
+		//Loop of a worker thread
+		void WorkerLoop();
+		//Take a job in the queue and run it, return false if the queue is empty
+		bool TryRunJob();
+		//Run the job and send is completion to the main thread
+		void RunJob(JobEntry& Job);
+	};
+}
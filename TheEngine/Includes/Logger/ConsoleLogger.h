@@ -1,15 +1,22 @@
 #pragma once
 
 #include "Logger/ILogger.h"
+#ifdef _WIN32
 #include <concrt.h>
+#endif
 
 namespace NPEngine
 {
-	//Logger provider for consol
+	//Logger provider for consol, the windows console or the standard output with the ANSI color on the other platform
 	class ConsoleLogger final : public ILogger
 	{
 	private:
+#ifdef _WIN32
 		HANDLE _HConsole = HANDLE();
+#else
+		//False when the output is a file or a pipe, the color code are not write
+		bool _bUseColor = false;
+#endif
 
 	public:
 		virtual ~ConsoleLogger() = default;
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace NPEngine
+{
+	//Subsystem of a allocation, set on the thread with MEMORY_SCOPE
+	enum EMemoryTag : uint8_t
+	{
+		MemoryTag_Untagged,
+		MemoryTag_World,
+		MemoryTag_Physics,
+		MemoryTag_Graphics,
+		MemoryTag_AI,
+		MemoryTag_Gameplay,
+		MemoryTag_Count
+	};
+
+	//Count the global new and delete by tag, the hook are in the build only with ENABLE_MEMORY_TRACKING
+	//Without it all the count stay at 0 and IsEnabled return false
+	//Only the new and delete are count, the malloc is not, the Eigen matrix of the AI use it so the AI tag show almost nothing
+	class MemoryTracker final
+	{
+	private:
+		static std::atomic<uint64_t> _AllocationCount;
+		static std::atomic<uint64_t> _LiveBytes[MemoryTag_Count];
+		static std::atomic<uint64_t> _PeakBytes[MemoryTag_Count];
+		static std::atomic<uint64_t> _TotalLiveBytes;
+		static std::atomic<uint64_t> _TotalPeakBytes;
+
+		//Allocation count at the start of the frame and number of allocation of the last frame
+		static uint64_t _FrameStartCount;
+		static uint64_t _LastFrameAllocations;
+
+		//Abort on the next allocation, for the test of the steady state
+		static std::atomic<bool> _bFailOnAllocation;
+
+		static thread_local EMemoryTag _CurrentTag;
+
+	public:
+		//Return true if the build have the allocation hook
+		static bool IsEnabled();
+
+		//Call by the global new and delete
+		static void OnAllocate(size_t Size, EMemoryTag Tag);
+		static void OnFree(size_t Size, EMemoryTag Tag);
+
+		//Tag of the new allocation of the current thread
+		static EMemoryTag GetCurrentTag() { return _CurrentTag; }
+		static void SetCurrentTag(EMemoryTag Tag) { _CurrentTag = Tag; }
+
+		//Call by the engine at the end of each frame
+		static void OnEndFrame();
+
+		//Return the number of allocation since the start of the process
+		static uint64_t GetAllocationCount() { return _AllocationCount.load(std::memory_order_relaxed); }
+		//Return the number of allocation of the last frame
+		static uint64_t GetFrameAllocations() { return _LastFrameAllocations; }
+		//Return the byte allocate and not free of the tag
+		static uint64_t GetLiveBytes(EMemoryTag Tag) { return Tag < MemoryTag_Count ? _LiveBytes[Tag].load(std::memory_order_relaxed) : 0; }
+		//Return the biggest live byte of the tag
+		static uint64_t GetPeakBytes(EMemoryTag Tag) { return Tag < MemoryTag_Count ? _PeakBytes[Tag].load(std::memory_order_relaxed) : 0; }
+		//Return the byte allocate and not free of all the tag
+		static uint64_t GetTotalLiveBytes() { return _TotalLiveBytes.load(std::memory_order_relaxed); }
+		//Return the biggest live byte of all the tag
+		static uint64_t GetTotalPeakBytes() { return _TotalPeakBytes.load(std::memory_order_relaxed); }
+
+		//Return the name of the tag
+		static const char* GetTagName(EMemoryTag Tag);
+
+		//After it any allocation print is tag and size and abort, for check a test dont allocate in the steady state
+		static void SetFailOnAllocation(bool bFailOnAllocation) { _bFailOnAllocation.store(bFailOnAllocation, std::memory_order_relaxed); }
+		static bool GetFailOnAllocation() { return _bFailOnAllocation.load(std::memory_order_relaxed); }
+	};
+
+	//Set the tag of the thread in the scope and restore the last at the end
+	class MemoryScope final
+	{
+	private:
+		EMemoryTag _LastTag = MemoryTag_Untagged;
+
+	public:
+		MemoryScope(EMemoryTag Tag) : _LastTag(MemoryTracker::GetCurrentTag()) { MemoryTracker::SetCurrentTag(Tag); }
+		~MemoryScope() { MemoryTracker::SetCurrentTag(_LastTag); }
+
+		MemoryScope(const MemoryScope&) = delete;
+		MemoryScope& operator=(const MemoryScope&) = delete;
+	};
+}
+
+#ifdef ENABLE_MEMORY_TRACKING
+#define MEMORY_CONCAT_INNER(A, B) A##B
+#define MEMORY_CONCAT(A, B) MEMORY_CONCAT_INNER(A, B)
+//Tag the allocation of the scope
+#define MEMORY_SCOPE(Tag) NPEngine::MemoryScope MEMORY_CONCAT(MemoryScope_, __LINE__)(Tag)
+#else
+#define MEMORY_SCOPE(Tag)
+#endif
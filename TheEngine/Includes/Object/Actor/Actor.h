@@ -40,6 +40,10 @@ namespace NPEngine
 
 		std::string _Name;
 
+		//Group of the update, after the physics by default
+		ETickGroup _TickGroup = TickGroup_PostPhysics;
+		bool _bParallelTick = false;
+
 	protected:
 		TransformComponent* _TransformComponent = nullptr;
 
@@ -63,16 +67,21 @@ namespace NPEngine
 		//Take a hit
 		virtual void TakeHit(float Damage) {};
 
+		//Save the transform read by the draw
+		void SaveDrawTransform();
+
 	protected:
 		virtual bool Initialise(const Param& Params) override;
 		virtual void Destroy(const Param& Params) override;
 
 		//Call when the frame start
 		virtual void BeginPlay() override;
-		//Call each frame
+		//Call each frame in the tick group of the actor
 		virtual void Update(float DeltaTime) override;
 		//Call each frame for Draw 
 		virtual void Draw() override;
+		//Return true if one drawable component is in the view
+		virtual bool IsInView(const Rectangle2D<float>& ViewRect) const override;
 
 	private:
 		std::map<std::string, Component*> _Components;
@@ -88,6 +97,8 @@ namespace NPEngine
 		virtual void OnCreateComponent() override final;
 		//Delete all compoennt to delete
 		virtual void OnDeleteComponent() override final;
+
+		virtual void AddTickFunctions(std::vector<TickFunction>* TickFunctions, std::vector<TickFunction>* ParallelTickFunctions) override final;
 		
 	public:
 		//return the current name
@@ -96,6 +107,14 @@ namespace NPEngine
 		virtual void SetDrawDepth(unsigned char DrawDepth) override;
 		virtual unsigned char GetDrawDepth() const override { return _DrawDepth; }
 
+		//Set the group of the update in the frame
+		void SetTickGroup(ETickGroup TickGroup);
+		ETickGroup GetTickGroup() const { return _TickGroup; }
+		//Update the actor on a worker while the main thread run the other update of the group
+		//The update must only change the actor and is component, no world, physics, audio or animation call
+		void SetParallelTick(bool bParallelTick);
+		bool GetParallelTick() const { return _bParallelTick; }
+
 		//Component
 		Component* GetComponentByName(const std::string& Name) const;
 		template <typename T> 
@@ -158,7 +177,7 @@ namespace NPEngine
 
 		for (auto& IT : _ClassComponents)
 		{
-			for (Component* BaseComponent : IT->second)
+			for (Component* BaseComponent : IT.second)
 			{
 				T* DerivedComponent = dynamic_cast<T*>(BaseComponent);
 				if (!DerivedComponent) break;
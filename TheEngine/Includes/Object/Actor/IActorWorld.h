@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Utility/Utility.h"
+#include "Math/Rectangle2D.h"
+#include "World/TickGroup.h"
+#include <vector>
 
 namespace NPEngine
 {
@@ -26,9 +29,13 @@ namespace NPEngine
 
 		//Call each frame
 		virtual void Update(float dt) = 0;
+		//Add the update of the actor and of the component with a own group in the list of the group, array of TickGroup_Count list
+		virtual void AddTickFunctions(std::vector<TickFunction>* TickFunctions, std::vector<TickFunction>* ParallelTickFunctions) = 0;
 		
 		//Call each frame for draw
 		virtual void Draw() = 0;
+		//Return if the actor draw something in the view rect, if not the draw is skip
+		virtual bool IsInView(const Rectangle2D<float>& ViewRect) const = 0;
 
 		//Create all component to add
 		virtual void OnCreateComponent() = 0;
@@ -4,6 +4,19 @@
 
 namespace NPEngine
 {
+	//Part of the tilemap bake in one texture
+	struct TileChunk
+	{
+	public:
+		size_t TextureId = 0;
+		//First tile of the chunk
+		Vector2D<int> FirstTile = Vector2D<int>(0, 0);
+		//Number of tile in the chunk
+		Vector2D<int> TileCount = Vector2D<int>(0, 0);
+		bool bTextureCreated = false;
+		bool bDirty = true;
+	};
+
 	//Class for a tilemap
 	class TileMap : public Actor
 	{
@@ -15,12 +28,29 @@ namespace NPEngine
 		Vector2D<float> _CellSize = Vector2D<float>(0.0f, 0.0f);
 		std::vector<int> _CollisionLayer;
 
+	private:
+		//Number of tile in a chunk side
+		const int _ChunkSize = 16;
+		//All chunk, row by row
+		std::vector<TileChunk> _Chunks;
+		//Number of chunk in X and Y
+		Vector2D<int> _ChunkCount = Vector2D<int>(0, 0);
+		//Render target generation of the last bake, all chunk are bake again when it change
+		uint32_t _RenderTargetGeneration = 0;
+
 	public:
 		TileMap(const std::string& Name);
 		virtual ~TileMap() = default;
 
 		virtual Actor* Clone(const std::string& Name, const Param& Params = Param{});
 
+		//Change a tile, only his chunk is bake again
+		void SetTile(int Layer, int Row, int Column, int Value);
+		//Return the tile value, -1 if empty or out of the map
+		int GetTile(int Layer, int Row, int Column) const;
+		//Return the rect cover by the tile, empty while the tile map is not load
+		Rectangle2D<float> GetBounds() const;
+
 	protected:
 		virtual bool Initialise(const Param& Params = Param{}) override;
 		virtual void Destroy(const Param& Params = Param{}) override;
@@ -28,14 +58,28 @@ namespace NPEngine
 		virtual void BeginPlay() override;
 
 		virtual void Draw() override;
+		//The chunk are cull in Draw
+		virtual bool IsInView(const Rectangle2D<float>& ViewRect) const override { return true; }
 
 	private:
 		//Load a tile set
 		void LoadTileSet(const std::string& TileSetPath);
-		//Load tile map at the path, use csv file
+		//Load tile map at the path, use csv file, the collision need it before the begin play so it is not async
 		void LoadTileMap(const std::vector<std::string>& LayerPath);
+		//Read all csv layer, return false if a cell is not a number
+		static bool ReadTileMap(const std::vector<std::string>& LayerPath, std::vector<std::vector<std::vector<int>>>* OutLayers);
+
+		//Set the grid collision with the current tile map
+		void UpdateCollisionGrid();
 
 		//Return a grid with collide cell
 		std::vector<std::vector<bool>> GetCollisionGrid() const;
+
+		//Create the chunk list with the tilemap size
+		void CreateChunks();
+		//Draw all tile of the chunk in his texture
+		void BakeChunk(TileChunk& Chunk);
+		//Delete all chunk texture
+		void DestroyChunks();
 	};
 }
\ No newline at end of file
@@ -13,10 +13,9 @@ namespace NPEngine
 		int SwitchIndex = 0;
 	};
 
-	//Structure with all animation data
+	//Structure with all animation data, only use to build a clip with AddAnimation
 	struct AnimationData
 	{
-		friend class AnimationComponent;
 	public:
 		float FrameInterval = 0.0f;
 		int StartIndex = 0;
@@ -27,48 +26,86 @@ namespace NPEngine
 
 		Flip AnimationFlip = Flip();
 
-		Delegate<void, int, const std::string&> AnimationObserver = Delegate<void, int, const std::string&>();
+		//Frame that broadcast the AnimationObserver of the component
+		std::vector<int> FramesToCallObserver;
 
 		//Add a new frame to call AnimationObserver
 		void AddFrameToCallObserver(int Frame);
 		//Remove a frame to call AnimationObeserver 
 		void RemoveFrameToCallObserver(int Frame);
-		//Clear all frame in FrameToCallObserver dictonary
+		//Clear all frame in FramesToCallObserver
 		void ClearAllFrameToCallObserver();
-
-	private:
-		std::unordered_map<int, bool> FrameToCallObserver;
-		std::string AnimationName = "";
 	};
 
-	//Component class for play a animation
-	class AnimationComponent : public AtlasComponent, public IUpdatableComponent
+	//Animation compiled in the clip table, never change after the add
+	struct AnimationClip
 	{
-	private:
-		AnimationData _BaseAnimationData = AnimationData();
+	public:
+		std::string Name = "";
 
-		AnimationData& _CurrentAnimation = _BaseAnimationData;
+		float FrameInterval = 0.0f;
+		int StartIndex = 0;
+		int EndIndex = 0;
+		bool bLoop = true;
 
-		std::map<std::string, AnimationData> _Animations;
+		Flip AnimationFlip = Flip();
+
+		//Clip to play at SwitchIndex, -1 for no switch
+		int SwitchClipId = -1;
+		int SwitchIndex = 0;
 
-		float _CurrentFrameTime = 0.0f;
+		std::vector<int> FramesToCallObserver;
+
+		//Return true if the frame broadcast the observer
+		bool CallObserverAt(int Frame) const;
+	};
+
+	//Component class for play a animation, the play is update by the AnimationSystem of the world
+	class AnimationComponent : public AtlasComponent
+	{
+		friend class AnimationSystem;
+	private:
+		//All clip, the clip id is the index
+		std::vector<AnimationClip> _Clips;
+		//Clip id by name, only use at add and for the lookup
+		std::map<std::string, int> _ClipIds;
+		//Switch name of each clip, only use to find the switch clip at add
+		std::vector<std::string> _SwitchNames;
+
+		int _CurrentClipId = -1;
+		//Slot in the AnimationSystem, -1 if not add
+		int _AnimationSlot = -1;
 
 	public:
+		//Call with the frame index and the clip id when a frame in FramesToCallObserver is play
+		Delegate<void, int, int> AnimationObserver = Delegate<void, int, int>();
+
 		AnimationComponent(const std::string& Name);
 		virtual ~AnimationComponent() = default;
 
-		//Add a new animation to _Animations
-		void AddAnimation(const std::string& AnimationName, AnimationData& NewAnimationData);
-		//Remove a animation to _Animation
-		void RemoveAnimation(const std::string& AnimationName);
+		//Compile a new animation in the clip table and return the clip id, -1 if the name is already use
+		int AddAnimation(const std::string& AnimationName, const AnimationData& NewAnimationData);
 
-		//Return the animation data at the name
-		AnimationData& GetAnimationData(const std::string& AnimationName);
-		//Set the current animation with the animationdata at this name
-		void SetCurrentAnimation(const std::string AnimationName);
+		//Return the clip id at this name, -1 if not found
+		int GetAnimationId(const std::string& AnimationName) const;
+		//Return the clip at this id, nullptr if not found
+		const AnimationClip* GetAnimationClip(int ClipId) const;
 
-	private:
-		void Update(float DeltaTime) override;
+		//Set the current animation with the clip at this id, no allocation
+		void SetCurrentAnimation(int ClipId);
+		//Set the current animation with the clip at this name
+		void SetCurrentAnimation(const std::string& AnimationName);
+		//Return the id of the clip in play, -1 if none
+		int GetCurrentAnimation() const { return _CurrentClipId; }
 
+	protected:
+		virtual bool Initialise(const Param& Params = Param{}) override;
+		virtual void Destroy(const Param& Params = Param{}) override;
+
+	private:
+		//Set the clip and restart it, without call the observer
+		void PlayClip(int ClipId);
+		//Broadcast the observer if the current frame is in the clip frame to call
+		void NotifyObserver(const AnimationClip& Clip);
 	};
-}
\ No newline at end of file
+}
@@ -15,9 +15,10 @@ namespace NPEngine
 		AtlasComponent(const std::string& Name);
 		virtual ~AtlasComponent() = default;
 
-	private:
+	protected:
 		virtual bool Initialise(const Param& Params = Param{}) override;
 
+	private:
 		virtual void Draw() override;
 		
 	public:
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Math/Rectangle2D.h"
+
 namespace NPEngine
 {
 	//A interface for draw a component
@@ -9,5 +11,7 @@ namespace NPEngine
 	private:
 		//Call each frame for draw the current component
 		virtual void Draw() = 0;
+		//Return if the component draw something in the view rect, if not the draw can be skip
+		virtual bool IsInView(const Rectangle2D<float>& ViewRect) const { return true; }
 	};
 }
\ No newline at end of file
@@ -1,11 +1,30 @@
 #pragma once
 
+#include "World/TickGroup.h"
+
 namespace NPEngine
 {
 	//Interface class for update the component
 	class IUpdatableComponent
 	{
 		friend class Actor;
+		friend class World;
+	private:
+		//TickGroup_Count for update with the owner actor
+		ETickGroup _TickGroup = TickGroup_Count;
+		bool _bParallelTick = false;
+
+	public:
+		virtual ~IUpdatableComponent() = default;
+
+		//Update the component in is own group, TickGroup_Count for update with the owner actor
+		void SetTickGroup(ETickGroup TickGroup);
+		ETickGroup GetTickGroup() const { return _TickGroup; }
+		//Update the component on a worker while the main thread run the other update of the group, only with is own group
+		//The update must only change the component, no world, physics, audio or animation call
+		void SetParallelTick(bool bParallelTick);
+		bool GetParallelTick() const { return _bParallelTick; }
+
 	private:
 		//Call each frame for update the component
 		virtual void Update(float DeltaTime) = 0;
@@ -43,6 +43,8 @@ namespace NPEngine
 		virtual void Destroy(const Param& Params = Param{}) override;
 
 		virtual void Draw() override;
+		//Only draw when the collision is draw
+		virtual bool IsInView(const Rectangle2D<float>& ViewRect) const override { return _Collision && _bDrawCollision; }
 
 		//Correct the velocity with the max speed
 		void CorrectMagnetude();
@@ -83,9 +85,6 @@ namespace NPEngine
 		//Set if the component need to correct movement
 		void SetCorrectMovement(bool bCorrectMovement) { _bCorrectMovement = bCorrectMovement; }
 
-		//Return all collision with this component 
-		std::vector<CollisionData> CheckCollision();
-
 		//Set the collision type
 		void SetCollision(const ECollisionType& CollisionType);
 		//Return the collision
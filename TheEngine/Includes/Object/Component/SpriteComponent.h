@@ -29,10 +29,14 @@ namespace NPEngine
 
 	protected:
 		virtual bool Initialise(const Param& Params = Param{}) override;
+		virtual void Destroy(const Param& Params = Param{}) override;
 
 	private:
 		virtual void Draw() override;
 
+	protected:
+		virtual bool IsInView(const Rectangle2D<float>& ViewRect) const override;
+
 	public:
 		//Set offset position for this component 
 		void SetOffsetPosition(const Vector2D<float>& OffsetPosition) { _OffsetPosition = OffsetPosition; }
@@ -47,6 +51,8 @@ namespace NPEngine
 		Vector2D<float> GetOffsetSize() const { return _OffsetSize; }
 		//Return the component size
 		Vector2D<float> GetSize() const;
+		//Return the component rect with the transform save for the draw
+		Rectangle2D<float> GetDrawRectangle() const;
 
 		//Set the flip data
 		void SetFlip(Flip NewFlip) { _Flip = NewFlip; }
@@ -15,6 +15,10 @@ namespace NPEngine
 		//Actor angle
 		float _Angle = 0.0f;
 
+		//Position and size at the last save, the draw read them while the physics can move the actor on a worker
+		Vector2D<float> _DrawPosition;
+		Vector2D<float> _DrawSize;
+
 	public:
 		TransformComponent(const std::string& Name);
 		virtual ~TransformComponent() = default;
@@ -43,6 +47,13 @@ namespace NPEngine
 		//Return the current position and size in a rectangle
 		Rectangle2D<float> GetPositionSizeRectangle();
 
+		//Save the current position and size for the draw, call by the world before the render
+		void SaveDrawTransform() { _DrawPosition = _Position; _DrawSize = _Size; }
+		//Return the position at the last save
+		Vector2D<float> GetDrawPosition() const { return _DrawPosition; }
+		//Return the size at the last save
+		Vector2D<float> GetDrawSize() const { return _DrawSize; }
+
 		//Return the angle
 		float GetAngle();
 		//Set the current angle
@@ -22,6 +22,12 @@ namespace NPEngine
 
 		//Call each frame for process the physics
 		virtual void UpdatePhysics(float DeltaTime) override = 0;
+		//Start to move the actor and find the collision on a worker, the delegate are call by ResolveCollisions
+		virtual void StartPhysics(float DeltaTime) override = 0;
+		//Wait the physics start by StartPhysics, before the world add or delete actor
+		virtual void FinishPhysics() override = 0;
+		//Call the collision delegate of the last physics on the main thread
+		virtual void ResolveCollisions() override = 0;
 
 		//Add a new physics actor for calcule physics each frame
 		virtual void AddPhysicsActor(const std::string& ActorName, PhysicsComponent* PhysicsComponentToAdd) override = 0;
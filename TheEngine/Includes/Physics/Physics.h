@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Physics/IPhysics.h"
+#include "Job/JobHandle.h"
 
 namespace NPEngine
 {
@@ -17,10 +18,21 @@ namespace NPEngine
 	private:
 		std::map<std::string, PhysicsComponent*> _PhysicsActors;
 
+		//Collision find by the last simulate, the delegate are call by ResolveCollisions
+		std::vector<std::pair<PhysicsComponent*, std::vector<CollisionData>>> _PendingCollisions;
+		//Job of the physics start with StartPhysics
+		JobHandle _SimulateJob;
+
 		virtual bool Initialize(const Param& Params = Param{}) override;
 		virtual void Shutdown(const Param& Params = Param{}) override;
 
 		virtual void UpdatePhysics(float DeltaTime) override;
+		virtual void StartPhysics(float DeltaTime) override;
+		virtual void FinishPhysics() override;
+		virtual void ResolveCollisions() override;
+
+		//Move the actor and find the collision, dont call the delegate, can run on a worker
+		void Simulate(float DeltaTime);
 
 		virtual void AddPhysicsActor(const std::string& ActorName, PhysicsComponent* PhysicsComponentToAdd) override;
 		virtual void RemovePhysicsActor(const std::string& Name) override;
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+
+namespace NPEngine
+{
+	//One zone time on a thread, time in nanosecond since the profiler start
+	struct ProfileEvent
+	{
+	public:
+		//Must stay valid until the export, use a string literal
+		const char* Name = nullptr;
+		uint64_t Start = 0;
+		uint64_t End = 0;
+	};
+
+	//Event of one thread, write only by the thread, the oldest are overwrite when it is full
+	struct ProfileThreadBuffer
+	{
+	public:
+		std::vector<ProfileEvent> Events;
+		//Number of event write since the thread start, only the thread change it
+		std::atomic<size_t> Count = 0;
+		//Count at the start and at the end of the last capture, set by the capture thread
+		std::atomic<size_t> CaptureStart = 0;
+		std::atomic<size_t> CaptureEnd = 0;
+		uint32_t ThreadId = 0;
+		std::string ThreadName;
+	};
+
+	//Instrumentation profiler, use the PROFILE_ macro, they compile to nothing without ENABLE_PROFILER
+	class Profiler final
+	{
+	private:
+		static std::atomic<bool> _bCapturing;
+		//Buffer of all thread that add a event, keep after the thread end for the export
+		static std::mutex _BuffersMutex;
+		static std::vector<std::unique_ptr<ProfileThreadBuffer>> _Buffers;
+		//Event keep per thread
+		static const size_t _BufferSize = 65536;
+		//Oldest event of a full ring not save, the zone open at the end of the capture still write after it
+		static const size_t _OpenZoneMargin = 64;
+
+		//Frame left to capture before the save, 0 when no capture is request
+		static int _CaptureFramesLeft;
+		static std::string _CapturePath;
+
+	public:
+		//Start to record the zone, the old event are drop
+		static void BeginCapture();
+		//Stop to record the zone
+		static void EndCapture();
+		//Return true while the zone are record
+		static bool IsCapturing() { return _bCapturing.load(std::memory_order_relaxed); }
+		//Capture the next frames and save them in the file at the end, call by the game on demand
+		static void RequestCapture(int FrameCount, const std::string& FilePath);
+		//Call by the engine at the end of each frame, save the request capture when it is done
+		static void OnEndFrame();
+
+		//Write all event in a chrome trace event json, open it in Perfetto or chrome://tracing, call after EndCapture
+		//Only the event between the BeginCapture and the EndCapture are write
+		static bool SaveChromeTrace(const std::string& FilePath);
+
+		//Name the current thread in the trace
+		static void SetThreadName(const char* Name);
+
+		//Return the time in nanosecond since the profiler start
+		static uint64_t GetTime();
+		//Add a event in the buffer of the current thread
+		static void AddEvent(const char* Name, uint64_t Start, uint64_t End);
+
+	private:
+		//Return the buffer of the current thread, create it the first time
+		static ProfileThreadBuffer& GetThreadBuffer();
+	};
+
+	//Time the scope and add the event at the end, nothing is record if the capture is not running
+	class ProfileZone final
+	{
+	private:
+		const char* _Name = nullptr;
+		uint64_t _Start = 0;
+		bool _bRecord = false;
+
+	public:
+		ProfileZone(const char* Name) : _Name(Name), _bRecord(Profiler::IsCapturing())
+		{
+			if (_bRecord) _Start = Profiler::GetTime();
+		}
+
+		~ProfileZone()
+		{
+			if (_bRecord) Profiler::AddEvent(_Name, _Start, Profiler::GetTime());
+		}
+
+		ProfileZone(const ProfileZone&) = delete;
+		ProfileZone& operator=(const ProfileZone&) = delete;
+	};
+}
+
+#ifdef ENABLE_PROFILER
+#define PROFILE_CONCAT_INNER(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_INNER(A, B)
+//Time the scope with a name, the name must be a string literal
+#define PROFILE_ZONE(Name) NPEngine::ProfileZone PROFILE_CONCAT(ProfileZone_, __LINE__)(Name)
+//Time the scope with the function name
+#define PROFILE_FUNCTION() PROFILE_ZONE(__FUNCTION__)
+//Name the current thread in the trace
+#define PROFILE_THREAD(Name) NPEngine::Profiler::SetThreadName(Name)
+#else
+#define PROFILE_ZONE(Name)
+#define PROFILE_FUNCTION()
+#define PROFILE_THREAD(Name)
+#endif
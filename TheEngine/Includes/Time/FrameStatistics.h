@@ -0,0 +1,125 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace NPEngine
+{
+	//Part of the engine frame with a time in the statistics
+	enum EFramePhase : uint8_t
+	{
+		FramePhase_StartFrame = 0,
+		FramePhase_UpdatePhysics = 1,
+		FramePhase_ProcessInput = 2,
+		FramePhase_Update = 3,
+		//Include the present
+		FramePhase_Render = 4,
+		FramePhase_Present = 5,
+		FramePhase_EndFrame = 6,
+		//Sleep and spin for keep the frame rate
+		FramePhase_Wait = 7,
+		//Number of phase, use for the all frame time
+		FramePhase_Count = 8
+	};
+
+	//Time of a phase on the frame in the window, in millisecond
+	struct FrameTimeSummary
+	{
+	public:
+		double Average = 0.0;
+		double P50 = 0.0;
+		double P95 = 0.0;
+		double P99 = 0.0;
+		double Max = 0.0;
+		size_t Count = 0;
+	};
+
+	//Time of one frame and of is phase, in nanosecond
+	struct FrameTimes
+	{
+	public:
+		uint64_t Total = 0;
+		uint64_t Phases[FramePhase_Count] = {};
+	};
+
+	//Keep the time of the last frame for the percentile, and a histogram of all the frame since the start
+	class FrameStatistics final
+	{
+	private:
+		//Last frame, the oldest is overwrite
+		std::vector<FrameTimes> _Frames;
+		const size_t _WindowSize = 1024;
+		//Number of frame end since the start or the reset
+		size_t _FrameCount = 0;
+		//Phase time of the frame in progress
+		FrameTimes _CurrentFrame = FrameTimes();
+
+		//Histogram in microsecond, each power of two is cut in 16 bucket, the error is under 7%
+		std::vector<uint64_t> _Histogram;
+		static const int _SubBucketBits = 5;
+		static const size_t _BucketCount = 400;
+
+		//File name start of the CSV, empty for no save at the shutdown
+		std::string _CSVPath;
+
+	public:
+		FrameStatistics();
+
+		//Add time in the phase of the frame in progress
+		void AddPhaseTime(EFramePhase Phase, uint64_t Nanoseconds);
+		//End the frame in progress with the time of all the frame
+		void EndFrame(uint64_t FrameNanoseconds);
+		//Drop all the frame
+		void Reset();
+
+		//Return the time of the phase on the frame in the window, FramePhase_Count for all the frame
+		FrameTimeSummary GetSummary(EFramePhase Phase = FramePhase_Count) const;
+		//Return the time in millisecond under which are Percent of the frame in the window
+		double GetPercentile(float Percent, EFramePhase Phase = FramePhase_Count) const;
+		//Return the time in millisecond under which are Percent of all the frame since the start, from the histogram
+		double GetHistogramPercentile(float Percent) const;
+		//Return true if Percent of the frame in the window take less than the budget, for the gameplay test
+		bool IsInBudget(double BudgetMilliseconds, float Percent = 99.0f, EFramePhase Phase = FramePhase_Count) const;
+		//Return the number of frame since the start or the reset
+		size_t GetFrameCount() const { return _FrameCount; }
+		//Return the time of the last frame end, empty before the first frame
+		FrameTimes GetLastFrame() const { return _FrameCount > 0 ? _Frames[(_FrameCount - 1) % _WindowSize] : FrameTimes(); }
+
+		//Set the file name start use by the shutdown and the key
+		void SetCSVPath(const std::string& Path) { _CSVPath = Path; }
+		const std::string& GetCSVPath() const { return _CSVPath; }
+		//Write Path + "Frames.csv", "Summary.csv" and "Histogram.csv", return false if a file fail
+		bool SaveCSV(const std::string& Path) const;
+
+		//Return the name of the phase
+		static const char* GetPhaseName(EFramePhase Phase);
+		//Return the time in nanosecond, for measure the phase
+		static uint64_t GetTime();
+
+	private:
+		//Return the time of the phase in the frame
+		static uint64_t GetPhaseTime(const FrameTimes& Frame, EFramePhase Phase);
+		//Return the bucket of the time in microsecond
+		static size_t GetBucket(uint64_t Microseconds);
+		//Return the smallest time in microsecond in the bucket
+		static uint64_t GetBucketStart(size_t Bucket);
+	};
+
+	//Add the time of the scope in a phase
+	class FramePhaseTimer final
+	{
+	private:
+		FrameStatistics& _Statistics;
+		EFramePhase _Phase = FramePhase_Count;
+		uint64_t _Start = 0;
+
+	public:
+		FramePhaseTimer(FrameStatistics& Statistics, EFramePhase Phase) : _Statistics(Statistics), _Phase(Phase), _Start(FrameStatistics::GetTime()) {}
+		~FramePhaseTimer() { _Statistics.AddPhaseTime(_Phase, FrameStatistics::GetTime() - _Start); }
+
+		FramePhaseTimer(const FramePhaseTimer&) = delete;
+		FramePhaseTimer& operator=(const FramePhaseTimer&) = delete;
+	};
+}
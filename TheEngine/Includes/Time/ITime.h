@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Time/ITimeProvider.h"
+#include "Time/FrameStatistics.h"
+#include <cstdint>
 
 namespace NPEngine
 {
@@ -10,17 +12,38 @@ namespace NPEngine
 	public:
 		virtual ~ITime() = default;
 		
-		//Return the current delta time
+		//Return the current delta time, smooth if the smoothing is set
 		virtual float GetDeltaTime() = 0;
+		//Return the time of the last frame in nanosecond, never smooth
+		virtual uint64_t GetDeltaTimeNanoseconds() const = 0;
 		//Set desired frame per second
 		virtual void SetFramePerSecond(int FramePerSecond) = 0;
+		//Set how much the delta time is average with the last frame, 0 for no smoothing, close to 1 for a strong one
+		virtual void SetDeltaTimeSmoothing(float Smoothing) = 0;
+		//Set the delta time give each frame in second, the real time is not use, <= 0 for the real time
+		virtual void SetFixedDeltaTime(float DeltaTime) = 0;
+		//Return the time of the last frame and of is phase
+		FrameStatistics& GetFrameStatistics() { return _FrameStatistics; }
 
 	protected:
-		long _LastFrameStartTime = 0;
-		long _CurrentFrameStartTime = 0;
+		//Time in counter tick
+		uint64_t _LastFrameStartTime = 0;
+		uint64_t _CurrentFrameStartTime = 0;
+		//Counter tick per second
+		uint64_t _CounterFrequency = 1;
+		uint64_t _DeltaTimeNanoseconds = 0;
 		float _DeltaTime = 0;
+		//Delta time average on the last frame
+		float _SmoothDeltaTime = 0;
+		float _DeltaTimeSmoothing = 0;
+		//<= 0 for the real delta time
+		float _FixedDeltaTime = 0;
 		int _FramesPerSecond = 60;
-		long _DesiredFrameDuration = 1000 / 60;
+		//In counter tick
+		uint64_t _DesiredFrameDuration = 0;
+		//The end of the wait spin instead of sleep, a sleep can wake up late, in counter tick
+		uint64_t _SpinDuration = 0;
+		FrameStatistics _FrameStatistics = FrameStatistics();
 
 	private:
 		//<= 0 for unlimited frame
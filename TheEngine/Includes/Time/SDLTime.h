@@ -15,7 +15,10 @@ namespace NPEngine
 		virtual ~SDLTime() = default;
 
 		float GetDeltaTime() override;
+		uint64_t GetDeltaTimeNanoseconds() const override;
 		void SetFramePerSecond(int FramePerSecond) override;
+		void SetDeltaTimeSmoothing(float Smoothing) override;
+		void SetFixedDeltaTime(float DeltaTime) override;
 
 	private:
 		virtual bool Initialize(const Param& Params) override;
@@ -29,5 +32,8 @@ namespace NPEngine
 		virtual void InitialiseTime() override;
 		virtual void OnStartFrame() override;
 		virtual void OnEndFrame() override;
+
+		//Change a counter tick time in nanosecond
+		uint64_t TicksToNanoseconds(uint64_t Ticks) const;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace NPEngine
+{
+	//Dense array of value find with handle, a handle is the slot index and the slot generation
+	//A removed handle is never valid again, even if the slot is reuse
+	template<typename T>
+	class HandleTable
+	{
+		static_assert(sizeof(size_t) >= 8, "HandleTable pack index and generation in a 64 bit size_t");
+
+	private:
+		//One value with is generation
+		struct Slot
+		{
+			T Value = T();
+			uint32_t Generation = 1;
+			bool bUsed = false;
+		};
+
+		std::vector<Slot> _Slots;
+		//Index of the slot not used
+		std::vector<uint32_t> _FreeSlots;
+
+	public:
+		//Add a value and return is handle, never 0
+		size_t Add(const T& Value)
+		{
+			uint32_t Index = 0;
+			if (!_FreeSlots.empty())
+			{
+				Index = _FreeSlots.back();
+				_FreeSlots.pop_back();
+			}
+			else
+			{
+				Index = static_cast<uint32_t>(_Slots.size());
+				_Slots.emplace_back();
+			}
+
+			Slot& CurrSlot = _Slots[Index];
+			CurrSlot.Value = Value;
+			CurrSlot.bUsed = true;
+
+			return MakeHandle(Index, CurrSlot.Generation);
+		}
+
+		//Return the value, nullptr if the handle is not valid
+		T* Get(size_t Handle)
+		{
+			uint32_t Index = GetIndex(Handle);
+			if (Index >= _Slots.size()) return nullptr;
+
+			Slot& CurrSlot = _Slots[Index];
+			if (!CurrSlot.bUsed || CurrSlot.Generation != GetGeneration(Handle)) return nullptr;
+
+			return &CurrSlot.Value;
+		}
+
+		//Return the value, nullptr if the handle is not valid
+		const T* Get(size_t Handle) const
+		{
+			return const_cast<HandleTable<T>*>(this)->Get(Handle);
+		}
+
+		//Remove the value, return false if the handle is not valid
+		bool Remove(size_t Handle)
+		{
+			if (!Get(Handle)) return false;
+
+			uint32_t Index = GetIndex(Handle);
+			Slot& CurrSlot = _Slots[Index];
+			CurrSlot.Value = T();
+			CurrSlot.bUsed = false;
+			CurrSlot.Generation++;
+			_FreeSlots.push_back(Index);
+
+			return true;
+		}
+
+		//Call the function with all used value
+		template<typename FunctionType>
+		void ForEach(FunctionType Function)
+		{
+			for (Slot& CurrSlot : _Slots)
+			{
+				if (CurrSlot.bUsed) Function(CurrSlot.Value);
+			}
+		}
+
+		//Call the function with the handle and the value of all used value
+		template<typename FunctionType>
+		void ForEachHandle(FunctionType Function)
+		{
+			for (uint32_t i = 0; i < _Slots.size(); i++)
+			{
+				if (_Slots[i].bUsed) Function(MakeHandle(i, _Slots[i].Generation), _Slots[i].Value);
+			}
+		}
+
+		//Call the function with the handle and the value of all used value
+		template<typename FunctionType>
+		void ForEachHandle(FunctionType Function) const
+		{
+			for (uint32_t i = 0; i < _Slots.size(); i++)
+			{
+				if (_Slots[i].bUsed) Function(MakeHandle(i, _Slots[i].Generation), static_cast<const T&>(_Slots[i].Value));
+			}
+		}
+
+		//Remove all value, the old handle stay not valid
+		void Clear()
+		{
+			for (uint32_t i = 0; i < _Slots.size(); i++)
+			{
+				if (_Slots[i].bUsed)
+				{
+					Remove(MakeHandle(i, _Slots[i].Generation));
+				}
+			}
+		}
+
+		//Return the number of used value
+		size_t Size() const { return _Slots.size() - _FreeSlots.size(); }
+
+	private:
+		static size_t MakeHandle(uint32_t Index, uint32_t Generation) { return (static_cast<size_t>(Generation) << 32) | Index; }
+		static uint32_t GetIndex(size_t Handle) { return static_cast<uint32_t>(Handle & 0xFFFFFFFF); }
+		static uint32_t GetGeneration(size_t Handle) { return static_cast<uint32_t>(Handle >> 32); }
+	};
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace NPEngine
+{
+	class AnimationComponent;
+	struct AnimationClip;
+
+	//Frame observer to call after all animation are update
+	struct AnimationEvent
+	{
+	public:
+		AnimationComponent* Component = nullptr;
+		int FrameIndex = 0;
+		int ClipId = -1;
+	};
+
+	//Update all animation component in one pass, the play state of each component is in array by slot
+	class AnimationSystem final
+	{
+		friend class World;
+		friend class AnimationComponent;
+	private:
+		//Component by slot
+		std::vector<AnimationComponent*> _Components;
+
+		//Play state by slot
+		std::vector<int> _ClipIds;
+		std::vector<float> _FrameTimes;
+		std::vector<int> _TileIndices;
+
+		//Data of the clip in play by slot, copy at the clip change
+		std::vector<float> _FrameIntervals;
+		std::vector<int> _StartIndices;
+		std::vector<int> _EndIndices;
+		//Tile where the play stop, -1 for a loop
+		std::vector<int> _StopIndices;
+		//Tile where the clip switch, -1 for no switch
+		std::vector<int> _SwitchIndices;
+
+		//1 if the slot change frame this frame, 2 if it switch clip
+		std::vector<int> _bSteps;
+
+		//Observer to call this frame
+		std::vector<AnimationEvent> _Events;
+
+	public:
+		//Return the number of animation component
+		size_t GetCount() const { return _Components.size(); }
+
+	private:
+		//Add the component and return is slot
+		int AddComponent(AnimationComponent* Component);
+		//Remove the slot, the last slot take is place
+		void RemoveComponent(int Slot);
+		//Copy the clip data in the slot and restart the clip
+		void SetClip(int Slot, int ClipId, const AnimationClip* Clip);
+
+		//Call by the world each frame
+		void Update(float DeltaTime);
+
+		//Remove all component
+		void Clear();
+	};
+}
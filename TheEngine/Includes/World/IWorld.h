@@ -42,6 +42,8 @@ namespace NPEngine
 		virtual void StartFrame() override = 0;
 
 		virtual void Update(float DeltaTime) override = 0;
+		virtual void RunTickGroup(ETickGroup Group, float DeltaTime) override = 0;
+		virtual void WaitTickGroups() override = 0;
 		virtual void PostUpdate() override = 0;
 
 		virtual void Render() override = 0;
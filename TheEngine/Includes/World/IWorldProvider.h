@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IServiceProvider.h"
+#include "World/TickGroup.h"
 
 namespace NPEngine
 {
@@ -18,10 +19,16 @@ namespace NPEngine
 		//Call at start of frame
 		virtual void StartFrame() = 0;
 
-		//Call each frame for update all actor
+		//Call each frame for update all actor of the post physics group
 		virtual void Update(float DeltaTime) = 0;
+		//Call the update of the group, the parallel update run on the job system
+		virtual void RunTickGroup(ETickGroup Group, float DeltaTime) = 0;
+		//Wait the parallel update of all the group
+		virtual void WaitTickGroups() = 0;
 		//Call each frame after update
 		virtual void PostUpdate() = 0;
+		//Save the transform of all actor for the render, after the update
+		virtual void SaveDrawTransforms() = 0;
 
 		//Call each frame for render all actor
 		virtual void Render() = 0;
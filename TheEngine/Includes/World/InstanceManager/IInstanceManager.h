@@ -31,6 +31,8 @@ namespace NPEngine
 		virtual Actor* GetCopyAt(std::string Name, std::string CopyName) = 0;
 		//Create a copy and spawn this copy in the world
 		virtual Actor* SpawnCopyInWorldAt(std::string Name, std::string CopyName) = 0;
+		//Create a copy and spawn this copy in the world, the params replace the same initialise params of the prototype
+		virtual Actor* SpawnCopyInWorldAt(std::string Name, std::string CopyName, const Param& Params) = 0;
 
 	private:
 		virtual bool Initialize(const Param& Params = Param{}) override = 0;
@@ -24,6 +24,7 @@ namespace NPEngine
 		virtual InstanceActor& GetInstanceAt(std::string Name) override;
 		virtual Actor* GetCopyAt(std::string Name, std::string CopyName) override;
 		virtual Actor* SpawnCopyInWorldAt(std::string Name, std::string CopyName) override;
+		virtual Actor* SpawnCopyInWorldAt(std::string Name, std::string CopyName, const Param& Params) override;
 
 	private:
 		virtual bool Initialize(const Param& Params = Param{}) override;
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+namespace NPEngine
+{
+	class Actor;
+	class IUpdatableComponent;
+
+	//Group of update in the frame, the group run in this order
+	enum ETickGroup : uint8_t
+	{
+		//After the input, before the physics, the velocity set here move the actor in this frame
+		TickGroup_PrePhysics,
+		//After the physics, the default group of the actor
+		TickGroup_PostPhysics,
+		//After the post update, before the transform of the draw are save
+		TickGroup_PreRender,
+		//After the render, before the actor are delete
+		TickGroup_Late,
+		TickGroup_Count
+	};
+
+	//Return the name of the group, a string literal for the profiler
+	inline const char* GetTickGroupName(ETickGroup Group)
+	{
+		switch (Group)
+		{
+		case TickGroup_PrePhysics: return "TickGroup::PrePhysics";
+		case TickGroup_PostPhysics: return "TickGroup::PostPhysics";
+		case TickGroup_PreRender: return "TickGroup::PreRender";
+		case TickGroup_Late: return "TickGroup::Late";
+		default: return "TickGroup::Unknow";
+		}
+	}
+
+	//One update to call in a group, the update of a actor or of a component with is own group
+	struct TickFunction
+	{
+	public:
+		Actor* Owner = nullptr;
+		//Null for the update of the actor
+		IUpdatableComponent* Component = nullptr;
+	};
+}
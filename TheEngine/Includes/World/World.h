@@ -2,6 +2,8 @@
 
 #include "World/IWorld.h"
 #include "World/Scene/Scene.h"
+#include "World/AnimationSystem.h"
+#include "Job/JobHandle.h"
 #include "Object/IObjectManager.h"
 #include <typeindex>
 #include <typeinfo>
@@ -75,6 +77,19 @@ namespace NPEngine
 		//Draw actor
 		std::vector<std::vector<Actor*>> _DrawActorOrder;
 
+		//Update all animation component after the actor
+		AnimationSystem _AnimationSystem;
+
+		//Update of each group, build again from the actor after a reset of the tick order
+		std::vector<TickFunction> _TickFunctions[TickGroup_Count];
+		//Update of each group that run on the job system
+		std::vector<TickFunction> _ParallelTickFunctions[TickGroup_Count];
+		bool _bTickOrderDirty = true;
+		//Bit of the group to wait before the group start, each group wait the last by default
+		uint8_t _TickGroupPrerequisites[TickGroup_Count] = { 0, 1 << TickGroup_PrePhysics, 1 << TickGroup_PostPhysics, 1 << TickGroup_PreRender };
+		//Job of the parallel update of each group not wait
+		std::vector<JobHandle> _TickGroupJobs[TickGroup_Count];
+
 	public:
 		virtual ~World() = default;
 
@@ -99,6 +114,13 @@ namespace NPEngine
 		
 		//Reset the draw order 
 		void ResetDrawOrder();
+		//Build again the update list of the group before the next group
+		void ResetTickOrder() { _bTickOrderDirty = true; }
+
+		//The group wait the parallel update of the prerequisite before it start, the prerequisite must be before in the frame
+		void AddTickGroupPrerequisite(ETickGroup Group, ETickGroup Prerequisite);
+		//The group can start while the parallel update of the prerequisite run, the physics, the render and the end of frame still wait all the group
+		void RemoveTickGroupPrerequisite(ETickGroup Group, ETickGroup Prerequisite);
 
 		//Add data in the persistente data
 		void AddInPersistenteData(const std::string& Key, std::any Value);
@@ -129,7 +151,10 @@ namespace NPEngine
 		virtual void StartFrame() override;
 
 		virtual void Update(float DeltaTime) override;
+		virtual void RunTickGroup(ETickGroup Group, float DeltaTime) override;
+		virtual void WaitTickGroups() override;
 		virtual void PostUpdate() override;
+		virtual void SaveDrawTransforms() override;
 
 		virtual void Render() override;
 		virtual void PostRender() override;
@@ -147,6 +172,15 @@ namespace NPEngine
 		void OnCallActorDeleteComponent();
 		//-------------
 
+		//Tick function
+		//Build the update list of each group from the actor
+		void BuildTickOrder();
+		//Wait the parallel update of the group
+		void WaitTickGroup(ETickGroup Group);
+		//Call the update of the actor or of the component
+		static void CallTick(const TickFunction& Tick, float DeltaTime);
+		//-------------
+
 		virtual void AddObject(size_t ID, Object* NewObject) override;
 		virtual void RemoveId(size_t ID) override;
 
@@ -157,6 +191,8 @@ namespace NPEngine
 		virtual Scene* GetSceneByName(const std::string& Name) override;
 
 		virtual Actor* GetActorByName(const std::string& Name) override;
+		//Return the system that update the animation component
+		AnimationSystem* GetAnimationSystem() { return &_AnimationSystem; }
 		//Return the actor with this class
 		template <typename T>
 		T* GetActorOfClass();
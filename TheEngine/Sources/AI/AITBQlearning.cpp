@@ -2,11 +2,13 @@
 
 #include "AI/AITBQlearning.h"
 #include "Engine.h"
+#include "Memory/MemoryTracker.h"
 
 using namespace NPEngine;
 
 AITBQLearning::AITBQLearning(int StateSize, int ActionSize, double LearningRate, double DiscountFactor, double Epsilon, double EpsilonDiscountFactor, float EpsilonUpdateDelay)
 {
+	MEMORY_SCOPE(MemoryTag_AI);
 	_Model = new AIToolbox::MDP::Model(StateSize, ActionSize, DiscountFactor);
 	_QLearning = new AIToolbox::MDP::QLearning(StateSize, ActionSize, DiscountFactor, LearningRate);
 	_QGreedyPolicy = new AIToolbox::MDP::QGreedyPolicy(_QLearning->getQFunction());
@@ -27,6 +29,7 @@ AITBQLearning::~AITBQLearning()
 
 void AITBQLearning::Initialize(int StateSize, int ActionSize, double LearningRate, double DiscountFactor, double Epsilon, double EpsilonDiscountFactor, float EpsilonUpdateDelay)
 {
+	MEMORY_SCOPE(MemoryTag_AI);
 	delete _Model;
 	delete _QLearning;
 	delete _QGreedyPolicy;
@@ -44,11 +47,13 @@ void AITBQLearning::Initialize(int StateSize, int ActionSize, double LearningRat
 
 int AITBQLearning::GetAction(int State) const
 {
+	MEMORY_SCOPE(MemoryTag_AI);
 	return _EpsilonPolicy->sampleAction(State);
 }
 
 void AITBQLearning::UpdateQTable(int CurrentState, int Action, double Reward, int NewState)
 {
+	MEMORY_SCOPE(MemoryTag_AI);
 	_QLearning->stepUpdateQ(CurrentState, Action, NewState, Reward);
 }
 
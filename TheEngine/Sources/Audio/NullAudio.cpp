@@ -0,0 +1,62 @@
+#include "Audio/NullAudio.h"
+
+#include <string>
+
+using namespace NPEngine;
+
+bool NullAudio::Initialize(const Param& Params)
+{
+	return true;
+}
+
+void NullAudio::Shutdown(const Param& Params)
+{
+}
+
+size_t NullAudio::LoadMusic(const std::string& Filename)
+{
+	//Same id as the SDL audio
+	std::hash<std::string> Hasher;
+	return Hasher(Filename);
+}
+
+size_t NullAudio::LoadSound(const std::string& Filename)
+{
+	std::hash<std::string> Hasher;
+	return Hasher(Filename);
+}
+
+size_t NullAudio::LoadSoundAsync(const std::string& Filename, const std::function<void(size_t, bool)>& OnLoaded)
+{
+	size_t SoundId = LoadSound(Filename);
+	if (OnLoaded) OnLoaded(SoundId, true);
+	return SoundId;
+}
+
+void NullAudio::PlayMusic(size_t MusicId, int Loop)
+{
+}
+
+void NullAudio::PlaySound(size_t SoundId, int Loop)
+{
+}
+
+void NullAudio::PauseMusic()
+{
+}
+
+void NullAudio::StopMusic()
+{
+}
+
+void NullAudio::ResumeMusic()
+{
+}
+
+void NullAudio::SetMusicVolume(int Volume)
+{
+}
+
+void NullAudio::SetSoundVolume(size_t SoundId, int Volume)
+{
+}
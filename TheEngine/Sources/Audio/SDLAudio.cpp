@@ -4,6 +4,7 @@
 #include "Logger/ILogger.h"
 #include <SDL_mixer.h>
 #include <string>
+#include <memory>
 
 using namespace NPEngine;
 
@@ -33,6 +34,8 @@ void SDLAudio::Shutdown(const Param& Params)
 		Sound.second = nullptr;
 	}
 	_SoundMap.clear();
+	_PendingSounds.clear();
+	_PendingVolumes.clear();
 
 	Mix_CloseAudio();
 }
@@ -68,8 +71,8 @@ size_t SDLAudio::LoadSound(const std::string& Filename)
 	std::hash<std::string> Hasher;
 	size_t SoundId = Hasher(Filename);
 
-	//Load the sound
-	if (_SoundMap.find(SoundId) == _SoundMap.end())
+	//Load the sound, a sound in loading on a worker is set when it finish
+	if (_SoundMap.find(SoundId) == _SoundMap.end() && _PendingSounds.find(SoundId) == _PendingSounds.end())
 	{
 		std::string FilePath = "./Assets/Audio/Sound/";
 		FilePath += Filename;
@@ -87,6 +90,85 @@ size_t SDLAudio::LoadSound(const std::string& Filename)
 	return SoundId;
 }
 
+//Own the sound decode by a worker, free it if the completion is never call
+struct SoundLoad
+{
+public:
+	Mix_Chunk* Sound = nullptr;
+
+	~SoundLoad()
+	{
+		if (Sound) Mix_FreeChunk(Sound);
+	}
+};
+
+size_t SDLAudio::LoadSoundAsync(const std::string& Filename, const std::function<void(size_t, bool)>& OnLoaded)
+{
+	//Get the ID
+	std::hash<std::string> Hasher;
+	size_t SoundId = Hasher(Filename);
+
+	//Already load
+	if (_SoundMap.find(SoundId) != _SoundMap.end())
+	{
+		if (OnLoaded) OnLoaded(SoundId, true);
+		return SoundId;
+	}
+
+	//Already in loading
+	auto Pending = _PendingSounds.find(SoundId);
+	if (Pending != _PendingSounds.end())
+	{
+		if (OnLoaded) Pending->second.push_back(OnLoaded);
+		return SoundId;
+	}
+
+	std::vector<std::function<void(size_t, bool)>>& Callbacks = _PendingSounds[SoundId];
+	if (OnLoaded) Callbacks.push_back(OnLoaded);
+
+	//Read and decode on a worker
+	std::string FilePath = "./Assets/Audio/Sound/";
+	FilePath += Filename;
+	std::shared_ptr<SoundLoad> Load = std::make_shared<SoundLoad>();
+	Engine::GetJobSystem()->AddJob(
+		[Load, FilePath]() { Load->Sound = Mix_LoadWAV(FilePath.c_str()); },
+		[this, Load, SoundId]()
+		{
+			FinishSoundLoad(SoundId, Load->Sound);
+			Load->Sound = nullptr;
+		});
+
+	return SoundId;
+}
+
+void SDLAudio::FinishSoundLoad(size_t SoundId, Mix_Chunk* Sound)
+{
+	std::vector<std::function<void(size_t, bool)>> Callbacks = std::move(_PendingSounds[SoundId]);
+	_PendingSounds.erase(SoundId);
+
+	if (Sound)
+	{
+		_SoundMap[SoundId] = Sound;
+
+		auto Volume = _PendingVolumes.find(SoundId);
+		if (Volume != _PendingVolumes.end())
+		{
+			Mix_VolumeChunk(Sound, Volume->second);
+			_PendingVolumes.erase(Volume);
+		}
+	}
+	else
+	{
+		Engine::GetLogger()->LogMessage("Sound effect not found");
+		_PendingVolumes.erase(SoundId);
+	}
+
+	for (const std::function<void(size_t, bool)>& Callback : Callbacks)
+	{
+		Callback(SoundId, Sound != nullptr);
+	}
+}
+
 void SDLAudio::PlayMusic(size_t MusicId, int Loop)
 {
 	//Get the music
@@ -107,6 +189,9 @@ void SDLAudio::PlayMusic(size_t MusicId, int Loop)
 
 void SDLAudio::PlaySound(size_t SoundId, int Loop)
 {
+	//Not loaded yet
+	if (_PendingSounds.find(SoundId) != _PendingSounds.end()) return;
+
 	//Get the sound
 	Mix_Chunk* Sound = _SoundMap[SoundId];
 	if (Sound)
@@ -149,6 +234,13 @@ void SDLAudio::SetMusicVolume(int Volume)
 
 void SDLAudio::SetSoundVolume(size_t SoundId, int Volume)
 {
+	//Set when the sound is loaded
+	if (_PendingSounds.find(SoundId) != _PendingSounds.end())
+	{
+		_PendingVolumes[SoundId] = std::max(0, std::min(Volume, MIX_MAX_VOLUME));
+		return;
+	}
+
 	Mix_Chunk* Sound = _SoundMap[SoundId];
 	if (Sound)
 	{
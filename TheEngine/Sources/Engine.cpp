@@ -1,17 +1,21 @@
 #include "Engine.h"
 
 #include "Graphics/SDLGraphics.h"
+#include "Graphics/NullGraphics.h"
+#include "Graphics/SoftwareGraphics.h"
 #include "Input/SDLInput.h"
+#include "Input/NullInput.h"
 #include "Time/SDLTime.h"
 #include "Audio/SDLAudio.h"
+#include "Audio/NullAudio.h"
 #include "World/InstanceManager/InstanceManager.h"
 #include "Physics/Physics.h"
+#include "Job/JobSystem.h"
+#include "Profiler/Profiler.h"
+#include "Memory/MemoryTracker.h"
 
-#if _DEBUG
 #include "Logger/ConsoleLogger.h"
-#else
 #include "Logger/FileLogger.h"
-#endif
 
 //#include <vld.h>
 
@@ -21,18 +25,32 @@ Engine* Engine::_InstanceEngine = nullptr;
 
 //Engine ----------------------------------------------------------------------------
 
-bool Engine::InitEngine(const char* Name, int Width, int Height)
+bool Engine::InitEngine(const char* Name, int Width, int Height, const Param& EngineParams)
 {
 	//VLDEnable();
 
 	Param Params;
 
-	//Initialise logger
+	//Initialise logger, the console in debug or with "ConsoleLog"
+	auto IT = EngineParams.find("ConsoleLog");
 #if _DEBUG
-	_Logger = new ConsoleLogger();
+	bool bConsoleLog = true;
 #else
-	_Logger = new FileLogger();
+	bool bConsoleLog = IT != EngineParams.end() && std::any_cast<bool>(IT->second);
 #endif
+	if (bConsoleLog)
+	{
+		_Logger = new ConsoleLogger();
+	}
+	else
+	{
+		_Logger = new FileLogger();
+	}
+	IT = EngineParams.find("LogPath");
+	if (IT != EngineParams.end())
+	{
+		Params["LogPath"] = IT->second;
+	}
 	_LoggerProvider = static_cast<ILoggerProvider*>(_Logger);
 	if (!_Logger || !_LoggerProvider || !_LoggerProvider->Initialize(Params))
 	{
@@ -41,6 +59,26 @@ bool Engine::InitEngine(const char* Name, int Width, int Height)
 	Params.clear();
 
 	//Initialise time
+	IT = EngineParams.find("FPS");
+	if (IT != EngineParams.end())
+	{
+		Params["FPS"] = IT->second;
+	}
+	IT = EngineParams.find("DeltaTimeSmoothing");
+	if (IT != EngineParams.end())
+	{
+		Params["DeltaTimeSmoothing"] = IT->second;
+	}
+	IT = EngineParams.find("FrameStatsPath");
+	if (IT != EngineParams.end())
+	{
+		Params["FrameStatsPath"] = IT->second;
+	}
+	IT = EngineParams.find("FixedDeltaTime");
+	if (IT != EngineParams.end())
+	{
+		Params["FixedDeltaTime"] = IT->second;
+	}
 	_Time = new SDLTime();
 	_TimeProvider = static_cast<ITimeProvider*>(_Time);
 	if (!_Time || !_TimeProvider || !_TimeProvider->Initialize(Params))
@@ -49,21 +87,88 @@ bool Engine::InitEngine(const char* Name, int Width, int Height)
 	}
 	Params.clear();
 
+	//Initialise job system
+	IT = EngineParams.find("WorkerCount");
+	if (IT != EngineParams.end())
+	{
+		Params["WorkerCount"] = IT->second;
+	}
+	_JobSystem = new JobSystem();
+	_JobSystemProvider = static_cast<IJobSystemProvider*>(_JobSystem);
+	if (!_JobSystem || !_JobSystemProvider || !_JobSystemProvider->Initialize(Params))
+	{
+		return false;
+	}
+	Params.clear();
+
 	//Initialise graphics
-	_Graphics = new SDLGraphics();
+	IT = EngineParams.find("GraphicsBackend");
+	EGraphicsBackend GraphicsBackend = IT != EngineParams.end() ? std::any_cast<EGraphicsBackend>(IT->second) : EGraphicsBackend::Graphics_SDL;
+	if (GraphicsBackend == EGraphicsBackend::Graphics_Null)
+	{
+		_Graphics = new NullGraphics();
+	}
+	else if (GraphicsBackend == EGraphicsBackend::Graphics_Software)
+	{
+		_Graphics = new SoftwareGraphics();
+	}
+	else
+	{
+		_Graphics = new SDLGraphics();
+	}
 	_GraphicsProvider = static_cast<IGraphicsProvider*>(_Graphics);
 	Params["Name"] = Name;
 	Params["Width"] = Width;
 	Params["Height"] = Height;
+	IT = EngineParams.find("RenderThread");
+	if (IT != EngineParams.end())
+	{
+		Params["RenderThread"] = IT->second;
+	}
+	IT = EngineParams.find("CaptureInterval");
+	if (IT != EngineParams.end())
+	{
+		Params["CaptureInterval"] = IT->second;
+	}
+	IT = EngineParams.find("CapturePath");
+	if (IT != EngineParams.end())
+	{
+		Params["CapturePath"] = IT->second;
+	}
 	if (!_Graphics || !_GraphicsProvider || !_GraphicsProvider->Initialize(Params))
 	{
 		return false;
 	}
 	_Graphics->SetBackgroundColor(Color::Black);
+	IT = EngineParams.find("TextureBudgetMB");
+	if (IT != EngineParams.end())
+	{
+		_Graphics->SetTextureBudget(static_cast<size_t>(std::any_cast<int>(IT->second)) * 1024 * 1024);
+	}
+	_DebugDraw = new DebugDraw();
+	_FrameStatsOverlay = new FrameStatsOverlay();
+	IT = EngineParams.find("StatsOverlayFont");
+	if (IT != EngineParams.end())
+	{
+		auto SizeIT = EngineParams.find("StatsOverlayFontSize");
+		int FontSize = SizeIT != EngineParams.end() ? std::any_cast<int>(SizeIT->second) : 14;
+		_FrameStatsOverlay->SetVisible(_FrameStatsOverlay->SetFont(std::any_cast<std::string>(IT->second), FontSize));
+	}
 	Params.clear();
 
+	//Headless use the null audio and input, no device is open
+	IT = EngineParams.find("Headless");
+	bool bHeadless = IT != EngineParams.end() && std::any_cast<bool>(IT->second);
+
 	//Initialise audio
-	_Audio = new SDLAudio();
+	if (bHeadless)
+	{
+		_Audio = new NullAudio();
+	}
+	else
+	{
+		_Audio = new SDLAudio();
+	}
 	_AudioProvider = static_cast<IAudioProvider*>(_Audio);
 	if (!_Audio || !_AudioProvider || !_AudioProvider->Initialize(Params))
 	{
@@ -72,7 +177,14 @@ bool Engine::InitEngine(const char* Name, int Width, int Height)
 	Params.clear();
 
 	//Initialise input
-	_Input = new SDLInput();
+	if (bHeadless)
+	{
+		_Input = new NullInput();
+	}
+	else
+	{
+		_Input = new SDLInput();
+	}
 	_InputProvider = static_cast<IInputProvider*>(_Input);
 	if (!_Input || !_InputProvider || !_InputProvider->Initialize(Params))
 	{
@@ -80,6 +192,25 @@ bool Engine::InitEngine(const char* Name, int Width, int Height)
 	}
 	Params.clear();
 
+	//Pipelined frame run the physics of the next frame on a worker while the render
+	IT = EngineParams.find("PipelinedFrame");
+	_bPipelinedFrame = IT != EngineParams.end() && std::any_cast<bool>(IT->second);
+
+	//Dedicated simulation run the world and the physics without the render
+	IT = EngineParams.find("SkipRender");
+	_bSkipRender = IT != EngineParams.end() && std::any_cast<bool>(IT->second);
+
+	IT = EngineParams.find("ProfilePath");
+	if (IT != EngineParams.end())
+	{
+		_ProfilePath = std::any_cast<std::string>(IT->second);
+	}
+	IT = EngineParams.find("ProfileFrames");
+	if (IT != EngineParams.end())
+	{
+		_ProfileFrames = std::any_cast<int>(IT->second);
+	}
+
 	//Initialise physics
 	_Physics = new Physics();
 	_PhysicsProvider = static_cast<IPhysicsProvider*>(_Physics);
@@ -116,102 +247,235 @@ bool Engine::InitEngine(const char* Name, int Width, int Height)
 }
 
 void Engine::Start(void)
+{
+	if (!BeginRun())
+	{
+		return;
+	}
+
+	while (GetEngineState().IsRunning)
+	{
+		RunFrame();
+	}
+
+	EndRun();
+}
+
+bool Engine::BeginRun()
 {
 	if (!GetEngineState().IsInit)
 	{
 		if (!InitEngine("Unknow title", 800, 600))
 		{
-			return;
+			return false;
 		}
 	}
 
 	GetEngineState().IsRunning = true;
 
 	_TimeProvider->InitialiseTime();
+	PROFILE_THREAD("Main");
 
-	while (GetEngineState().IsRunning)
+	return true;
+}
+
+void Engine::RunFrame()
+{
 	{
+		PROFILE_ZONE("Frame");
+
 		_TimeProvider->OnStartFrame();
 
 		StartFrame();
 
-		UpdatePhysics(_Time->GetDeltaTime());
-
+		//The input is before the physics, the pre physics group move the actor with the input of this frame
 		ProcessInput();
 		PostInput();
+		RunTickGroup(TickGroup_PrePhysics, _Time->GetDeltaTime());
+
+		UpdatePhysics(_Time->GetDeltaTime());
 
 		Update(_Time->GetDeltaTime());
 		PostUpdate();
+		RunTickGroup(TickGroup_PreRender, _Time->GetDeltaTime());
+
+		//The render draw the transform save here, the physics job can move the actor while the render
+		if (!_bSkipRender)
+		{
+			_WorldProvider->SaveDrawTransforms();
+		}
+		if (_bPipelinedFrame)
+		{
+			StartPhysics(_Time->GetDeltaTime());
+		}
 
-		Render();
-		PostRender();
+		if (!_bSkipRender)
+		{
+			Render();
+			PostRender();
+		}
+
+		//The world add and delete actor only when the physics job is done
+		if (_bPipelinedFrame)
+		{
+			FinishPhysics();
+		}
+		RunTickGroup(TickGroup_Late, _Time->GetDeltaTime());
 
 		EndFrame();
 
+		PROFILE_ZONE("WaitFrame");
 		_TimeProvider->OnEndFrame();
 	}
 
-	Shutdown();
+	//After the frame zone, a capture end with is last frame complete
+	Profiler::OnEndFrame();
+	MemoryTracker::OnEndFrame();
 }
 
-//-----------------------------------------------------------------------------------
-
-//Flow ------------------------------------------------------------------------------
+void Engine::EndRun()
+{
+	Shutdown();
+}
 
 void Engine::StartFrame()
 {
+	PROFILE_ZONE("StartFrame");
+	FramePhaseTimer PhaseTimer(_Time->GetFrameStatistics(), FramePhase_StartFrame);
+
+	//Finish the async job before the world use there result
+	_JobSystemProvider->ProcessMainThreadJobs();
+
 	_WorldProvider->StartFrame();
 }
 
 void Engine::ProcessInput()
 {
+	PROFILE_ZONE("ProcessInput");
+	FramePhaseTimer PhaseTimer(_Time->GetFrameStatistics(), FramePhase_ProcessInput);
+
 	_InputProvider->ProcessInput();
-	
 
 	if (_Input->IsKeyDown(Key_Escape))
 	{
 		Engine::GetEngineInstance()->GetEngineState().IsRunning = false;
 	}
+
+	//Save the frame statistics once per press
+	bool bSaveStatsKeyDown = _Input->IsKeyDown(Key_F9);
+	FrameStatistics& Statistics = _Time->GetFrameStatistics();
+	if (bSaveStatsKeyDown && !_bSaveStatsKeyDown && !Statistics.GetCSVPath().empty())
+	{
+		Statistics.SaveCSV(Statistics.GetCSVPath());
+		_Logger->LogMessage("Frame statistics save in %s", Statistics.GetCSVPath().c_str());
+	}
+	_bSaveStatsKeyDown = bSaveStatsKeyDown;
+
+#ifdef ENABLE_PROFILER
+	//Capture the next frames once per press, the file is save by the profiler at the end
+	bool bProfileKeyDown = _Input->IsKeyDown(Key_F10);
+	if (bProfileKeyDown && !_bProfileKeyDown && !_ProfilePath.empty() && !Profiler::IsCapturing())
+	{
+		Profiler::RequestCapture(_ProfileFrames, _ProfilePath);
+		_Logger->LogMessage("Profile capture of %d frames start", _ProfileFrames);
+	}
+	_bProfileKeyDown = bProfileKeyDown;
+#endif
 }
 
 void Engine::PostInput()
 {
+	MEMORY_SCOPE(MemoryTag_Gameplay);
 	_InputProvider->UpdateInputListener(_Time->GetDeltaTime());
 }
 
 void Engine::UpdatePhysics(float DeltaTime)
 {
+	PROFILE_ZONE("UpdatePhysics");
+	FramePhaseTimer PhaseTimer(_Time->GetFrameStatistics(), FramePhase_UpdatePhysics);
+	MEMORY_SCOPE(MemoryTag_Physics);
+
+	//The physics move the actor, no parallel update can run
+	_WorldProvider->WaitTickGroups();
+
+	//The pipelined physics of this frame is run by the last frame, only the collision delegate are left
+	if (_bPipelinedFrame)
+	{
+		_PhysicsProvider->ResolveCollisions();
+		return;
+	}
 	_PhysicsProvider->UpdatePhysics(DeltaTime);
 }
 
+void Engine::StartPhysics(float DeltaTime)
+{
+	PROFILE_ZONE("StartPhysics");
+	FramePhaseTimer PhaseTimer(_Time->GetFrameStatistics(), FramePhase_UpdatePhysics);
+	MEMORY_SCOPE(MemoryTag_Physics);
+	_WorldProvider->WaitTickGroups();
+	_PhysicsProvider->StartPhysics(DeltaTime);
+}
+
+void Engine::FinishPhysics()
+{
+	PROFILE_ZONE("FinishPhysics");
+	FramePhaseTimer PhaseTimer(_Time->GetFrameStatistics(), FramePhase_UpdatePhysics);
+	_PhysicsProvider->FinishPhysics();
+}
+
 static Rectangle2D<float> MovableRect = Rectangle2D<float>(Vector2D<float>(0.0f, 0.0f), Vector2D<float>(100.0f, 100.0f));
 
 void Engine::Update(float DeltaTime)
 {
+	PROFILE_ZONE("Update");
+	FramePhaseTimer PhaseTimer(_Time->GetFrameStatistics(), FramePhase_Update);
+	MEMORY_SCOPE(MemoryTag_Gameplay);
 	_WorldProvider->Update(DeltaTime);
 }
 
+void Engine::RunTickGroup(ETickGroup Group, float DeltaTime)
+{
+	FramePhaseTimer PhaseTimer(_Time->GetFrameStatistics(), FramePhase_Update);
+	MEMORY_SCOPE(MemoryTag_Gameplay);
+	_WorldProvider->RunTickGroup(Group, DeltaTime);
+}
+
 void Engine::PostUpdate()
 {
+	MEMORY_SCOPE(MemoryTag_Gameplay);
 	_WorldProvider->PostUpdate();
 }
 
 void Engine::Render(void)
 {
+	PROFILE_ZONE("Render");
+	FramePhaseTimer PhaseTimer(_Time->GetFrameStatistics(), FramePhase_Render);
+	MEMORY_SCOPE(MemoryTag_Graphics);
+
 	_GraphicsProvider->Clear();
 
 	_WorldProvider->Render();
 
+	//All debug shape in one draw, over the world
+	_DebugDraw->Flush();
+
+	_FrameStatsOverlay->Draw();
+
+	PROFILE_ZONE("Present");
+	FramePhaseTimer PresentTimer(_Time->GetFrameStatistics(), FramePhase_Present);
 	_GraphicsProvider->Present();
 }
 
 void Engine::PostRender()
 {
+	MEMORY_SCOPE(MemoryTag_Graphics);
 	_WorldProvider->PostRender();
 }
 
 void Engine::EndFrame()
 {
+	PROFILE_ZONE("EndFrame");
+	FramePhaseTimer PhaseTimer(_Time->GetFrameStatistics(), FramePhase_EndFrame);
 	_WorldProvider->EndFrame();
 }
 
@@ -239,6 +503,16 @@ void Engine::Shutdown(void)
 	}
 	Params.clear();
 
+	//Delete job system, before the service a job can use
+	if (_JobSystem && _JobSystemProvider)
+	{
+		_JobSystemProvider->Shutdown(Params);
+		delete _JobSystem;
+		_JobSystem = nullptr;
+		_JobSystemProvider = nullptr;
+	}
+	Params.clear();
+
 	//Delete physics
 	if (_Physics && _PhysicsProvider)
 	{
@@ -268,6 +542,12 @@ void Engine::Shutdown(void)
 	}
 	Params.clear();
 
+	//Delete debug draw
+	delete _DebugDraw;
+	_DebugDraw = nullptr;
+	delete _FrameStatsOverlay;
+	_FrameStatsOverlay = nullptr;
+
 	//Delete graphics
 	if (_Graphics && _GraphicsProvider)
 	{
@@ -340,6 +620,21 @@ IAudio* Engine::GetAudio()
 	return GetEngineInstance()->_Audio;
 }
 
+IJobSystem* Engine::GetJobSystem()
+{
+	return GetEngineInstance()->_JobSystem;
+}
+
+DebugDraw* Engine::GetDebugDraw()
+{
+	return GetEngineInstance()->_DebugDraw;
+}
+
+FrameStatsOverlay* Engine::GetFrameStatsOverlay()
+{
+	return GetEngineInstance()->_FrameStatsOverlay;
+}
+
 IInstanceManager* Engine::GetInstanceManager()
 {
 	return GetEngineInstance()->_InstanceManager;
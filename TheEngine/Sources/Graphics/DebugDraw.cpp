@@ -0,0 +1,75 @@
+#include "Graphics/DebugDraw.h"
+
+#include "Engine.h"
+#include <cmath>
+
+using namespace NPEngine;
+
+void DebugDraw::DrawLine(const Vector2D<float>& Start, const Vector2D<float>& End, const Color& Color)
+{
+	DebugLine NewLine;
+	NewLine.Start = Start;
+	NewLine.End = End;
+	NewLine.Color = Color.rgba;
+	_Lines.push_back(NewLine);
+}
+
+void DebugDraw::DrawRect(const Rectangle2D<float>& Rect, const Color& Color)
+{
+	Vector2D<float> TopLeft = Rect.Position;
+	Vector2D<float> TopRight = Vector2D<float>(Rect.Position.X + Rect.Size.X, Rect.Position.Y);
+	Vector2D<float> BottomRight = Vector2D<float>(Rect.Position.X + Rect.Size.X, Rect.Position.Y + Rect.Size.Y);
+	Vector2D<float> BottomLeft = Vector2D<float>(Rect.Position.X, Rect.Position.Y + Rect.Size.Y);
+
+	DrawLine(TopLeft, TopRight, Color);
+	DrawLine(TopRight, BottomRight, Color);
+	DrawLine(BottomRight, BottomLeft, Color);
+	DrawLine(BottomLeft, TopLeft, Color);
+}
+
+void DebugDraw::DrawCircle(const Vector2D<float>& Position, float Ray, const Color& Color)
+{
+	const std::array<Vector2D<float>, DebugCircleSegments + 1>& UnitCircle = GetUnitCircle();
+
+	Vector2D<float> Previous = Vector2D<float>(Position.X + UnitCircle[0].X * Ray, Position.Y + UnitCircle[0].Y * Ray);
+	for (int i = 1; i <= DebugCircleSegments; i++)
+	{
+		Vector2D<float> Current = Vector2D<float>(Position.X + UnitCircle[i].X * Ray, Position.Y + UnitCircle[i].Y * Ray);
+		DrawLine(Previous, Current, Color);
+		Previous = Current;
+	}
+}
+
+void DebugDraw::DrawPoint(const Vector2D<float>& Position, const Color& Color)
+{
+	const float HalfSize = 2.0f;
+	DrawLine(Vector2D<float>(Position.X - HalfSize, Position.Y), Vector2D<float>(Position.X + HalfSize, Position.Y), Color);
+	DrawLine(Vector2D<float>(Position.X, Position.Y - HalfSize), Vector2D<float>(Position.X, Position.Y + HalfSize), Color);
+}
+
+void DebugDraw::Flush()
+{
+	if (_Lines.empty()) return;
+
+	//The vector keep is capacity for the next frame
+	Engine::GetGraphics()->DrawLines(_Lines.data(), _Lines.size());
+	_Lines.clear();
+}
+
+const std::array<Vector2D<float>, DebugCircleSegments + 1>& DebugDraw::GetUnitCircle()
+{
+	//Compute once, the circle only scale and move the point
+	static const std::array<Vector2D<float>, DebugCircleSegments + 1> UnitCircle = []()
+	{
+		std::array<Vector2D<float>, DebugCircleSegments + 1> Points;
+		for (int i = 0; i < DebugCircleSegments; i++)
+		{
+			float Angle = static_cast<float>(i) / static_cast<float>(DebugCircleSegments) * 6.28318530718f;
+			Points[i] = Vector2D<float>(std::cos(Angle), std::sin(Angle));
+		}
+		Points[DebugCircleSegments] = Points[0];
+		return Points;
+	}();
+
+	return UnitCircle;
+}
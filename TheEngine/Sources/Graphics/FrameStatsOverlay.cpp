@@ -0,0 +1,61 @@
+#include "Graphics/FrameStatsOverlay.h"
+#include "Engine.h"
+#include "Memory/MemoryTracker.h"
+#include <cstdio>
+
+using namespace NPEngine;
+
+bool FrameStatsOverlay::SetFont(const std::string& Filename, int FontSize)
+{
+	_FontId = Engine::GetGraphics()->LoadFont(Filename, FontSize);
+	return _FontId != 0;
+}
+
+void FrameStatsOverlay::Draw()
+{
+	if (!_bVisible || _FontId == 0) return;
+
+	IGraphics* Graphics = Engine::GetGraphics();
+	const FrameStats& Stats = Graphics->GetFrameStats();
+
+	//Fixed buffer, no allocation per frame, the memory line only with the allocation hook
+	const int MaxLineCount = 6 + 2 + MemoryTag_Count;
+	char Lines[MaxLineCount][64];
+	int LineCount = 6;
+	snprintf(Lines[0], sizeof(Lines[0]), "Draw calls: %zu", Stats.DrawCalls);
+	snprintf(Lines[1], sizeof(Lines[1]), "Texture binds: %zu", Stats.TextureBinds);
+	snprintf(Lines[2], sizeof(Lines[2]), "Batches: %zu", Stats.BatchesFlushed);
+	snprintf(Lines[3], sizeof(Lines[3]), "Quads: %zu", Stats.QuadsSubmitted);
+	snprintf(Lines[4], sizeof(Lines[4]), "Text raster: %zu", Stats.TextRasterizations);
+	snprintf(Lines[5], sizeof(Lines[5]), "Present: %.2f ms", Stats.PresentTime);
+	if (MemoryTracker::IsEnabled())
+	{
+		snprintf(Lines[LineCount++], sizeof(Lines[0]), "Alloc/frame: %llu", static_cast<unsigned long long>(MemoryTracker::GetFrameAllocations()));
+		snprintf(Lines[LineCount++], sizeof(Lines[0]), "Memory: %llu KB (peak %llu KB)",
+			static_cast<unsigned long long>(MemoryTracker::GetTotalLiveBytes() / 1024), static_cast<unsigned long long>(MemoryTracker::GetTotalPeakBytes() / 1024));
+		for (uint8_t i = 0; i < MemoryTag_Count; i++)
+		{
+			EMemoryTag Tag = static_cast<EMemoryTag>(i);
+			snprintf(Lines[LineCount++], sizeof(Lines[0]), "  %s: %llu KB (peak %llu KB)", MemoryTracker::GetTagName(Tag),
+				static_cast<unsigned long long>(MemoryTracker::GetLiveBytes(Tag) / 1024), static_cast<unsigned long long>(MemoryTracker::GetPeakBytes(Tag) / 1024));
+		}
+	}
+
+	Vector2D<int> TextSize = Vector2D<int>(0, 0);
+	Graphics->GetTextSize(_FontId, Lines[0], &TextSize);
+	int LineHeight = TextSize.Y > 0 ? TextSize.Y : 16;
+
+	Graphics->SetScreenSpace(true);
+
+	Rectangle2D<float> Background = Rectangle2D<float>(
+		Vector2D<float>(static_cast<float>(_Position.X - 5), static_cast<float>(_Position.Y - 5)),
+		Vector2D<float>(MemoryTracker::IsEnabled() ? 280.0f : 200.0f, static_cast<float>(LineHeight * LineCount + 10)));
+	Graphics->DrawRect(Background, Color(0, 0, 0, 160), true);
+
+	for (int i = 0; i < LineCount; i++)
+	{
+		Graphics->DrawString(_FontId, Lines[i], Vector2D<int>(_Position.X, _Position.Y + LineHeight * i), Color::White);
+	}
+
+	Graphics->SetScreenSpace(false);
+}
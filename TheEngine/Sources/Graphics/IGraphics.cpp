@@ -0,0 +1,30 @@
+#include "Graphics/IGraphics.h"
+#include "Engine.h"
+#include "Logger/ILogger.h"
+#include <algorithm>
+
+using namespace NPEngine;
+
+void IGraphics::LogTextureResidency() const
+{
+	std::vector<TextureResidency> Residency = GetTextureResidency();
+	//Last use first, the next texture to evict are at the end
+	std::sort(Residency.begin(), Residency.end(), [](const TextureResidency& A, const TextureResidency& B)
+	{
+		return A.LastUseFrame > B.LastUseFrame;
+	});
+
+	size_t ResidentBytes = 0;
+	Engine::GetLogger()->LogMessage("Texture residency:");
+	for (const TextureResidency& Texture : Residency)
+	{
+		if (Texture.bResident) ResidentBytes += Texture.Bytes;
+
+		Engine::GetLogger()->LogMessage("  %s %dx%d %zu KB, ref %d, last use %zu%s%s",
+			Texture.Name.empty() ? "<render texture>" : Texture.Name.c_str(),
+			Texture.Size.X, Texture.Size.Y, Texture.Bytes / 1024, Texture.RefCount, Texture.LastUseFrame,
+			Texture.bInAtlas ? ", atlas" : "", Texture.bResident ? "" : ", evicted");
+	}
+
+	Engine::GetLogger()->LogMessage("  %zu texture, %zu KB resident", Residency.size(), ResidentBytes / 1024);
+}
@@ -0,0 +1,134 @@
+#include "Graphics/MaxRectsPacker.h"
+
+#include <algorithm>
+#include <climits>
+
+using namespace NPEngine;
+
+//Return true if A is inside B
+static bool RectContain(const Rectangle2D<int>& A, const Rectangle2D<int>& B)
+{
+	return A.Position.X >= B.Position.X && A.Position.Y >= B.Position.Y
+		&& A.Position.X + A.Size.X <= B.Position.X + B.Size.X
+		&& A.Position.Y + A.Size.Y <= B.Position.Y + B.Size.Y;
+}
+
+MaxRectsPacker::MaxRectsPacker(const Vector2D<int>& Size)
+{
+	_Size = Size;
+	_FreeRects.push_back(Rectangle2D<int>(Vector2D<int>(0, 0), Size));
+}
+
+bool MaxRectsPacker::Insert(const Vector2D<int>& Size, Rectangle2D<int>* OutRect)
+{
+	//Find the free rect where the short side left is the smallest
+	int BestShortSide = INT_MAX;
+	int BestLongSide = INT_MAX;
+	Rectangle2D<int> BestRect = Rectangle2D<int>(Vector2D<int>(0, 0), Vector2D<int>(0, 0));
+	bool bFound = false;
+
+	for (const Rectangle2D<int>& CurrFreeRect : _FreeRects)
+	{
+		if (CurrFreeRect.Size.X < Size.X || CurrFreeRect.Size.Y < Size.Y) continue;
+
+		int LeftX = CurrFreeRect.Size.X - Size.X;
+		int LeftY = CurrFreeRect.Size.Y - Size.Y;
+		int ShortSide = std::min(LeftX, LeftY);
+		int LongSide = std::max(LeftX, LeftY);
+
+		if (ShortSide < BestShortSide || (ShortSide == BestShortSide && LongSide < BestLongSide))
+		{
+			BestShortSide = ShortSide;
+			BestLongSide = LongSide;
+			BestRect = Rectangle2D<int>(CurrFreeRect.Position, Size);
+			bFound = true;
+		}
+	}
+
+	if (!bFound) return false;
+
+	//Split all free rect who touch the new one
+	for (size_t i = 0; i < _FreeRects.size();)
+	{
+		if (SplitFreeRect(_FreeRects[i], BestRect))
+		{
+			_FreeRects[i] = _FreeRects.back();
+			_FreeRects.pop_back();
+		}
+		else
+		{
+			i++;
+		}
+	}
+	PruneFreeRects();
+
+	*OutRect = BestRect;
+	return true;
+}
+
+const Vector2D<int>& MaxRectsPacker::GetSize() const
+{
+	return _Size;
+}
+
+bool MaxRectsPacker::SplitFreeRect(const Rectangle2D<int>& FreeRect, const Rectangle2D<int>& UsedRect)
+{
+	//No overlap
+	if (UsedRect.Position.X >= FreeRect.Position.X + FreeRect.Size.X || UsedRect.Position.X + UsedRect.Size.X <= FreeRect.Position.X
+		|| UsedRect.Position.Y >= FreeRect.Position.Y + FreeRect.Size.Y || UsedRect.Position.Y + UsedRect.Size.Y <= FreeRect.Position.Y)
+	{
+		return false;
+	}
+
+	//Copy, FreeRect is in the vector we push in
+	const Rectangle2D<int> Free = FreeRect;
+
+	//Top part
+	if (UsedRect.Position.Y > Free.Position.Y)
+	{
+		_FreeRects.push_back(Rectangle2D<int>(Free.Position, Vector2D<int>(Free.Size.X, UsedRect.Position.Y - Free.Position.Y)));
+	}
+	//Bottom part
+	if (UsedRect.Position.Y + UsedRect.Size.Y < Free.Position.Y + Free.Size.Y)
+	{
+		int Top = UsedRect.Position.Y + UsedRect.Size.Y;
+		_FreeRects.push_back(Rectangle2D<int>(Vector2D<int>(Free.Position.X, Top), Vector2D<int>(Free.Size.X, Free.Position.Y + Free.Size.Y - Top)));
+	}
+	//Left part
+	if (UsedRect.Position.X > Free.Position.X)
+	{
+		_FreeRects.push_back(Rectangle2D<int>(Free.Position, Vector2D<int>(UsedRect.Position.X - Free.Position.X, Free.Size.Y)));
+	}
+	//Right part
+	if (UsedRect.Position.X + UsedRect.Size.X < Free.Position.X + Free.Size.X)
+	{
+		int Left = UsedRect.Position.X + UsedRect.Size.X;
+		_FreeRects.push_back(Rectangle2D<int>(Vector2D<int>(Left, Free.Position.Y), Vector2D<int>(Free.Position.X + Free.Size.X - Left, Free.Size.Y)));
+	}
+
+	return true;
+}
+
+void MaxRectsPacker::PruneFreeRects()
+{
+	for (size_t i = 0; i < _FreeRects.size(); i++)
+	{
+		for (size_t j = i + 1; j < _FreeRects.size();)
+		{
+			if (RectContain(_FreeRects[i], _FreeRects[j]))
+			{
+				_FreeRects.erase(_FreeRects.begin() + i);
+				i--;
+				break;
+			}
+			if (RectContain(_FreeRects[j], _FreeRects[i]))
+			{
+				_FreeRects.erase(_FreeRects.begin() + j);
+			}
+			else
+			{
+				j++;
+			}
+		}
+	}
+}
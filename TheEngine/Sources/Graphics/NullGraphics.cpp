@@ -0,0 +1,431 @@
+#include "Graphics/NullGraphics.h"
+
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+#include "Engine.h"
+#include "Logger/ILogger.h"
+#include <fstream>
+#include <string>
+#include <memory>
+
+using namespace NPEngine;
+
+bool NullGraphics::Initialize(const Param& Params)
+{
+	//No window, no sound card, use the dummy audio if the environment dont ask another one
+	SDL_SetHintWithPriority(SDL_HINT_AUDIODRIVER, "dummy", SDL_HINT_DEFAULT);
+
+	if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) != 0)
+	{
+		Engine::GetLogger()->LogMessage(SDL_GetError());
+		return false;
+	}
+
+	auto IT = Params.find("Width");
+	_ScreenSize.X = IT != Params.end() ? std::any_cast<int>(IT->second) : 800;
+	IT = Params.find("Height");
+	_ScreenSize.Y = IT != Params.end() ? std::any_cast<int>(IT->second) : 600;
+
+	//Font work without window, use for the text size
+	if (TTF_Init() == -1)
+	{
+		Engine::GetLogger()->LogMessage(TTF_GetError());
+		return false;
+	}
+
+	return true;
+}
+
+void NullGraphics::Shutdown(const Param& Params)
+{
+	_Textures.Clear();
+	_TextureHandles.clear();
+	_PendingTextures.clear();
+
+	_Fonts.ForEach([](_TTF_Font*& Font)
+	{
+		TTF_CloseFont(Font);
+		Font = nullptr;
+	});
+	_Fonts.Clear();
+	_FontHandles.clear();
+
+	TTF_Quit();
+	SDL_Quit();
+}
+
+void NullGraphics::SetBackgroundColor(const Color& Color)
+{
+	_BackgroundColor = Color;
+}
+
+void NullGraphics::SetColor(const Color& Color)
+{
+}
+
+void NullGraphics::DrawRect(const Rectangle2D<float>& Rect, const Color& Color, bool bFill)
+{
+	_CurrentStats.DrawCalls++;
+}
+
+void NullGraphics::DrawLine(const Vector2D<float>& Start, const Vector2D<float>& End, const Color& Color)
+{
+	_CurrentStats.DrawCalls++;
+}
+
+void NullGraphics::DrawPoint(const Vector2D<float>& Position, const Color& Color)
+{
+	_CurrentStats.DrawCalls++;
+}
+
+void NullGraphics::DrawCircle(const Vector2D<float>& Position, const float Ray, const Color& Color)
+{
+	_CurrentStats.DrawCalls++;
+}
+
+void NullGraphics::DrawLines(const DebugLine* Lines, size_t Count)
+{
+	//All the line are one draw
+	if (Count == 0) return;
+	_CurrentStats.DrawCalls++;
+}
+
+size_t NullGraphics::LoadTexture(const std::string& Filename)
+{
+	//Already load
+	auto IT = _TextureHandles.find(Filename);
+	if (IT != _TextureHandles.end()) return IT->second;
+
+	NullTextureRecord Record;
+	Record.Name = Filename;
+	Record.LastUseFrame = _FrameIndex;
+	if (!ReadTextureSize(Filename, &Record.Size))
+	{
+		Engine::GetLogger()->LogMessage("Texture not found");
+		return 0;
+	}
+
+	size_t TextureId = _Textures.Add(Record);
+	_TextureHandles[Filename] = TextureId;
+
+	return TextureId;
+}
+
+size_t NullGraphics::LoadTextureAsync(const std::string& Filename, const std::function<void(size_t)>& OnLoaded)
+{
+	//Already load or in loading
+	auto IT = _TextureHandles.find(Filename);
+	if (IT != _TextureHandles.end())
+	{
+		auto Pending = _PendingTextures.find(IT->second);
+		if (Pending != _PendingTextures.end())
+		{
+			if (OnLoaded) Pending->second.push_back(OnLoaded);
+		}
+		else if (OnLoaded)
+		{
+			OnLoaded(IT->second);
+		}
+		return IT->second;
+	}
+
+	NullTextureRecord Record;
+	Record.Name = Filename;
+	Record.bLoaded = false;
+	Record.LastUseFrame = _FrameIndex;
+	size_t TextureId = _Textures.Add(Record);
+	_TextureHandles[Filename] = TextureId;
+	std::vector<std::function<void(size_t)>>& Callbacks = _PendingTextures[TextureId];
+	if (OnLoaded) Callbacks.push_back(OnLoaded);
+
+	//Read the size on a worker
+	std::shared_ptr<Vector2D<int>> Size = std::make_shared<Vector2D<int>>(-1, -1);
+	Engine::GetJobSystem()->AddJob(
+		[Size, Filename]() { if (!ReadTextureSize(Filename, Size.get())) *Size = Vector2D<int>(-1, -1); },
+		[this, Size, TextureId]()
+		{
+			auto Pending = _PendingTextures.find(TextureId);
+			NullTextureRecord* Texture = _Textures.Get(TextureId);
+			if (Pending == _PendingTextures.end() || !Texture) return;
+
+			std::vector<std::function<void(size_t)>> Callbacks = std::move(Pending->second);
+			_PendingTextures.erase(Pending);
+
+			size_t LoadedId = TextureId;
+			if (Size->X < 0)
+			{
+				Engine::GetLogger()->LogMessage("Texture not found");
+				_TextureHandles.erase(Texture->Name);
+				_Textures.Remove(TextureId);
+				LoadedId = 0;
+			}
+			else
+			{
+				Texture->Size = *Size;
+				Texture->bLoaded = true;
+			}
+
+			for (const std::function<void(size_t)>& Callback : Callbacks)
+			{
+				Callback(LoadedId);
+			}
+		});
+
+	return TextureId;
+}
+
+bool NullGraphics::IsTextureLoaded(size_t TextureId) const
+{
+	return GetLoadedTexture(TextureId) != nullptr;
+}
+
+const NullTextureRecord* NullGraphics::GetLoadedTexture(size_t TextureId) const
+{
+	const NullTextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture || !Texture->bLoaded) return nullptr;
+	return Texture;
+}
+
+bool NullGraphics::UseTexture(size_t TextureId)
+{
+	NullTextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture || !Texture->bLoaded) return false;
+
+	Texture->LastUseFrame = _FrameIndex;
+	return true;
+}
+
+bool NullGraphics::ReadTextureSize(const std::string& Filename, Vector2D<int>* Size)
+{
+	std::string FilePath = "./Assets/Texture/";
+	FilePath += Filename;
+
+	//Only the size is need, read it in the header or load the image if it is not a png
+	if (ReadImageSize(FilePath, Size)) return true;
+
+	SDL_Surface* Surface = IMG_Load(FilePath.c_str());
+	if (!Surface) return false;
+
+	*Size = Vector2D<int>(Surface->w, Surface->h);
+	SDL_FreeSurface(Surface);
+	return true;
+}
+
+void NullGraphics::DrawTexture(size_t TextureId, const Rectangle2D<float>& DrawRect, const Color& Color, float Angle, const Flip& Flip)
+{
+	if (!UseTexture(TextureId)) return;
+	_CurrentStats.DrawCalls++;
+	_CurrentStats.QuadsSubmitted++;
+}
+
+void NullGraphics::DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const Vector2D<int>& CellPosition, const Color& Color, float Angle, const Flip& Flip)
+{
+	if (!UseTexture(TextureId)) return;
+	_CurrentStats.DrawCalls++;
+	_CurrentStats.QuadsSubmitted++;
+}
+
+void NullGraphics::DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const int& CellIndex, const Color& Color, float Angle, const Flip& Flip)
+{
+	if (CellIndex < 0 || !UseTexture(TextureId)) return;
+	_CurrentStats.DrawCalls++;
+	_CurrentStats.QuadsSubmitted++;
+}
+
+void NullGraphics::GetTextureSize(size_t TextureId, Vector2D<int>* Size)
+{
+	const NullTextureRecord* Texture = GetLoadedTexture(TextureId);
+	if (!Texture) return;
+
+	*Size = Texture->Size;
+}
+
+void NullGraphics::UnloadTexture(size_t TextureId)
+{
+	NullTextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture) return;
+
+	//A texture in loading is drop when the worker finish
+	_PendingTextures.erase(TextureId);
+
+	if (!Texture->Name.empty())
+	{
+		_TextureHandles.erase(Texture->Name);
+	}
+	_Textures.Remove(TextureId);
+}
+
+void NullGraphics::AcquireTexture(size_t TextureId)
+{
+	NullTextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture) return;
+
+	Texture->RefCount++;
+}
+
+void NullGraphics::ReleaseTexture(size_t TextureId)
+{
+	NullTextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture || Texture->RefCount <= 0) return;
+
+	Texture->RefCount--;
+}
+
+void NullGraphics::SetTextureBudget(size_t Bytes)
+{
+	//No pixel in memory, nothing to evict
+}
+
+std::vector<TextureResidency> NullGraphics::GetTextureResidency() const
+{
+	std::vector<TextureResidency> Residency;
+	Residency.reserve(_Textures.Size());
+
+	//The byte are the one the texture would use in a other backend
+	_Textures.ForEachHandle([&Residency](size_t TextureId, const NullTextureRecord& Texture)
+	{
+		TextureResidency Entry;
+		Entry.TextureId = TextureId;
+		Entry.Name = Texture.Name;
+		Entry.Size = Texture.Size;
+		Entry.Bytes = static_cast<size_t>(Texture.Size.X) * Texture.Size.Y * 4;
+		Entry.RefCount = Texture.RefCount;
+		Entry.LastUseFrame = Texture.LastUseFrame;
+		Entry.bResident = Texture.bLoaded;
+		Residency.push_back(Entry);
+	});
+
+	return Residency;
+}
+
+size_t NullGraphics::CreateRenderTexture(const Vector2D<int>& Size)
+{
+	NullTextureRecord Record;
+	Record.Size = Size;
+	return _Textures.Add(Record);
+}
+
+bool NullGraphics::BeginDrawToTexture(size_t TextureId)
+{
+	return _Textures.Get(TextureId) != nullptr;
+}
+
+void NullGraphics::EndDrawToTexture()
+{
+}
+
+size_t NullGraphics::LoadFont(const std::string& Filename, int FontSize)
+{
+	std::string FontName = Filename + ":" + std::to_string(FontSize);
+	auto IT = _FontHandles.find(FontName);
+	if (IT != _FontHandles.end()) return IT->second;
+
+	std::string FilePath = "./Assets/Font/";
+	FilePath += Filename;
+
+	TTF_Font* Font = TTF_OpenFont(FilePath.c_str(), FontSize);
+	if (!Font)
+	{
+		Engine::GetLogger()->LogMessage(TTF_GetError());
+		return 0;
+	}
+
+	size_t FontId = _Fonts.Add(Font);
+	_FontHandles[FontName] = FontId;
+
+	return FontId;
+}
+
+void NullGraphics::DrawString(size_t FontId, const char* Text, const Vector2D<int>& Location, const Color& Color)
+{
+	if (!_Fonts.Get(FontId)) return;
+	_CurrentStats.DrawCalls++;
+}
+
+void NullGraphics::GetTextSize(size_t FontId, const char* Text, Vector2D<int>* Size)
+{
+	_TTF_Font** Font = _Fonts.Get(FontId);
+	if (!Font || !*Font) return;
+
+	int Width = 0;
+	int Height = 0;
+	if (TTF_SizeText(*Font, Text, &Width, &Height) != 0) return;
+
+	Size->X = Width;
+	Size->Y = Height;
+}
+
+Vector2D<int> NullGraphics::GetScreenSize() const
+{
+	return _ScreenSize;
+}
+
+bool NullGraphics::CheckPointIsOutOfScreen(const Vector2D<float>& Point) const
+{
+	Rectangle2D<float> ViewRect = GetViewRect();
+
+	if (Point.X < ViewRect.Position.X || Point.Y < ViewRect.Position.Y
+		|| Point.X > ViewRect.Position.X + ViewRect.Size.X || Point.Y > ViewRect.Position.Y + ViewRect.Size.Y)
+	{
+		return true;
+	}
+	return false;
+}
+
+void NullGraphics::SetCamera(const Camera& NewCamera)
+{
+	_Camera = NewCamera;
+	if (_Camera.Zoom <= 0.0f)
+	{
+		_Camera.Zoom = 1.0f;
+	}
+}
+
+Rectangle2D<float> NullGraphics::GetViewRect() const
+{
+	Vector2D<int> ViewportSize = _ScreenSize;
+	if (_Camera.Viewport.Size.X > 0 && _Camera.Viewport.Size.Y > 0)
+	{
+		ViewportSize = _Camera.Viewport.Size;
+	}
+
+	return Rectangle2D<float>(_Camera.Position, Vector2D<float>(ViewportSize.X / _Camera.Zoom, ViewportSize.Y / _Camera.Zoom));
+}
+
+void NullGraphics::SetScreenSpace(bool bScreenSpace)
+{
+	_bScreenSpace = bScreenSpace;
+}
+
+void NullGraphics::Clear()
+{
+}
+
+void NullGraphics::Present()
+{
+	PublishFrameStats(_CurrentStats);
+	_CurrentStats = FrameStats();
+	_FrameIndex++;
+}
+
+bool NullGraphics::ReadImageSize(const std::string& FilePath, Vector2D<int>* Size)
+{
+	std::ifstream File(FilePath, std::ios::binary);
+	if (!File.is_open()) return false;
+
+	//Png signature then the IHDR chunk with width and height in big endian
+	unsigned char Header[24] = { 0 };
+	if (!File.read(reinterpret_cast<char*>(Header), sizeof(Header))) return false;
+
+	const unsigned char Signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	for (int i = 0; i < 8; i++)
+	{
+		if (Header[i] != Signature[i]) return false;
+	}
+	if (Header[12] != 'I' || Header[13] != 'H' || Header[14] != 'D' || Header[15] != 'R') return false;
+
+	Size->X = (Header[16] << 24) | (Header[17] << 16) | (Header[18] << 8) | Header[19];
+	Size->Y = (Header[20] << 24) | (Header[21] << 16) | (Header[22] << 8) | Header[23];
+	return true;
+}
@@ -4,8 +4,13 @@
 #include <SDL_image.h>
 #include "Engine.h"
 #include "Logger/ILogger.h"
+#include "Profiler/Profiler.h"
 #include <string>
 #include <SDL_ttf.h>
+#include <algorithm>
+#include <string_view>
+#include <memory>
+#include <cmath>
 
 using namespace NPEngine;
 
@@ -34,12 +39,25 @@ bool SDLGraphics::Initialize(const Param& Params)
 		return false;
 	}
 
+	//Start the render thread, all renderer call are made on it
+	IT = Params.find("RenderThread");
+	_bUseRenderThread = IT != Params.end() ? std::any_cast<bool>(IT->second) : false;
+	if (_bUseRenderThread)
+	{
+		_RenderThread = std::thread(&SDLGraphics::RenderThreadLoop, this);
+		_RenderThreadId = _RenderThread.get_id();
+	}
+
 	//Init renderer
-	Uint32 RenderFlags = SDL_RENDERER_ACCELERATED;
-	_Renderer = SDL_CreateRenderer(_Window, -1, RenderFlags);
+	RunOnRenderThread([this]()
+	{
+		Uint32 RenderFlags = SDL_RENDERER_ACCELERATED;
+		_Renderer = SDL_CreateRenderer(_Window, -1, RenderFlags);
+	});
 	if (!_Renderer)
 	{
 		Engine::GetLogger()->LogMessage(SDL_GetError());
+		StopRenderThread();
 		return false;
 	}
 
@@ -49,33 +67,111 @@ bool SDLGraphics::Initialize(const Param& Params)
 		return false;
 	}
 
+	//The render texture are empty after a reset, the watch see the event before the input poll it
+	SDL_AddEventWatch(&SDLGraphics::OnRenderEvent, this);
+
 	return true;
 }
 
-void SDLGraphics::Shutdown(const Param& Params)
+int SDLGraphics::OnRenderEvent(void* UserData, SDL_Event* Event)
 {
-	for (auto& Texture : _TextureMap)
+	if (Event->type == SDL_RENDER_TARGETS_RESET || Event->type == SDL_RENDER_DEVICE_RESET)
 	{
-		SDL_DestroyTexture(Texture.second);
-		Texture.second = nullptr;
+		SDLGraphics* Graphics = static_cast<SDLGraphics*>(UserData);
+		Graphics->_RenderTargetGeneration.fetch_add(1, std::memory_order_release);
 	}
-	_TextureMap.clear();
+	return 0;
+}
 
-	for (auto& Font : _FontMap)
+void SDLGraphics::Shutdown(const Param& Params)
+{
+	//Wait the last frame
+	if (_bUseRenderThread)
 	{
-		TTF_CloseFont(Font.second);
-		Font.second = nullptr;
+		std::unique_lock<std::mutex> Lock(_RenderMutex);
+		_RenderCondition.wait(Lock, [this]() { return _SubmitList == nullptr; });
 	}
-	_FontMap.clear();
 
-	SDL_DestroyRenderer(_Renderer);
-	_Renderer = nullptr;
+	SDL_DelEventWatch(&SDLGraphics::OnRenderEvent, this);
+
+	RunOnRenderThread([this]() { ReleaseRenderResources(); });
+	StopRenderThread();
+
+	_Textures.Clear();
+	_TextureHandles.clear();
+	_PendingTextures.clear();
+	_AtlasPages.clear();
+
+	_Fonts.ForEach([](FontData& Font)
+	{
+		TTF_CloseFont(Font.Font);
+		Font.Font = nullptr;
+	});
+	_Fonts.Clear();
+	_FontHandles.clear();
+
 	SDL_DestroyWindow(_Window);
 	_Window = nullptr;
 	TTF_Quit();
 	SDL_Quit();
 }
 
+void SDLGraphics::StopRenderThread()
+{
+	if (!_RenderThread.joinable()) return;
+
+	{
+		std::lock_guard<std::mutex> Lock(_RenderMutex);
+		_bStopRenderThread = true;
+	}
+	_RenderCondition.notify_all();
+	_RenderThread.join();
+	_bUseRenderThread = false;
+}
+
+void SDLGraphics::ReleaseRenderResources()
+{
+	//Texture unload in the frame not present
+	for (const DrawCommand& Command : GetRecordList())
+	{
+		if (Command.Type == EDrawCommandType::DrawCommand_DestroyTexture)
+		{
+			SDL_DestroyTexture(Command.Texture.Texture);
+		}
+	}
+	GetRecordList().clear();
+	GetRecordLines().clear();
+
+	_Textures.ForEach([](TextureRecord& Texture)
+	{
+		if (!Texture.Data.bInAtlas)
+		{
+			SDL_DestroyTexture(Texture.Data.Texture);
+		}
+		Texture.Data.Texture = nullptr;
+	});
+
+	for (AtlasPage& Page : _AtlasPages)
+	{
+		if (Page.Texture) SDL_DestroyTexture(Page.Texture);
+		Page.Texture = nullptr;
+	}
+	_BatchRuns.clear();
+	_BatchRunCount = 0;
+
+	_Fonts.ForEach([](FontData& Font)
+	{
+		for (AtlasPage& Page : Font.Pages)
+		{
+			SDL_DestroyTexture(Page.Texture);
+			Page.Texture = nullptr;
+		}
+	});
+
+	SDL_DestroyRenderer(_Renderer);
+	_Renderer = nullptr;
+}
+
 void SDLGraphics::SetBackgroundColor(const Color& Color)
 {
 	_BackgroundColor = Color;
@@ -83,279 +179,832 @@ void SDLGraphics::SetBackgroundColor(const Color& Color)
 
 void SDLGraphics::SetColor(const Color& Color)
 {
-	SDL_SetRenderDrawColor(_Renderer, Color.rgba.R, Color.rgba.G, Color.rgba.B, Color.rgba.A);
+	_DrawColor = Color;
 }
 
 void SDLGraphics::DrawRect(const Rectangle2D<float>& Rect, const Color& Color, bool bFill)
 {
-	SetColor(Color);
-
-	SDL_FRect SDLRect = { 0.0f };
-	SDLRect.x = Rect.Position.X;
-	SDLRect.y = Rect.Position.Y;
-	SDLRect.w = Rect.Size.X;
-	SDLRect.h = Rect.Size.Y;
-
-	if (bFill)
-	{
-		SDL_RenderFillRectF(_Renderer, &SDLRect);
-	}
-	else
-	{
-		SDL_RenderDrawRectF(_Renderer, &SDLRect);
-	}
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_Rect;
+	Command.Rect = WorldToScreen(Rect);
+	Command.Color = Color.rgba;
+	Command.bFlag = bFill;
+	GetRecordList().push_back(Command);
 }
 
 void SDLGraphics::DrawLine(const Vector2D<float>& Start, const Vector2D<float>& End, const Color& Color)
 {
-	SetColor(Color);
-
-	SDL_RenderDrawLineF(_Renderer, Start.X, Start.Y, End.X, End.Y);
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_Line;
+	Command.Rect = Rectangle2D<float>(WorldToScreen(Start), WorldToScreen(End));
+	Command.Color = Color.rgba;
+	GetRecordList().push_back(Command);
 }
 
 void SDLGraphics::DrawPoint(const Vector2D<float>& Position, const Color& Color)
 {
-	SetColor(Color);
-
-	SDL_RenderDrawPointF(_Renderer, Position.X, Position.Y);
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_Point;
+	Command.Rect.Position = WorldToScreen(Position);
+	Command.Color = Color.rgba;
+	GetRecordList().push_back(Command);
 }
 
 void SDLGraphics::DrawCircle(const Vector2D<float>& Position, const float Ray, const Color& Color)
 {
-	SetColor(Color);
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_Circle;
+	Command.Rect.Position = WorldToScreen(Position);
+	Command.Rect.Size.X = UseCamera() ? Ray * _Camera.Zoom : Ray;
+	Command.Color = Color.rgba;
+	GetRecordList().push_back(Command);
+}
 
-	const int Resolution = 360;
+void SDLGraphics::DrawLines(const DebugLine* Lines, size_t Count)
+{
+	if (Count == 0) return;
 
-	for (int i = 0; i < Resolution; i++)
-	{
-		float Angle = static_cast<float>(i) / static_cast<float>(Resolution) * (2.0f * static_cast<float>(M_PI));
-		float X = Position.X + Ray * cos(Angle);
-		float Y = Position.Y + Ray * sin(Angle);
+	//The lines are keep beside the command list, the command only have the range
+	std::vector<DebugLine>& RecordLines = GetRecordLines();
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_Lines;
+	Command.SourceRect.Position.X = static_cast<int>(RecordLines.size());
+	Command.SourceRect.Size.X = static_cast<int>(Count);
 
-		SDL_RenderDrawPointF(_Renderer, X, Y);
+	for (size_t i = 0; i < Count; i++)
+	{
+		DebugLine ScreenLine = Lines[i];
+		ScreenLine.Start = WorldToScreen(Lines[i].Start);
+		ScreenLine.End = WorldToScreen(Lines[i].End);
+		RecordLines.push_back(ScreenLine);
 	}
+	GetRecordList().push_back(Command);
 }
 
 void SDLGraphics::DrawTexture(size_t TextureId, const Rectangle2D<float>& DrawRect, const Color& Color, float Angle, const Flip& Flip)
 {
 	//Get the texture
-	SDL_Texture* Texture = _TextureMap[TextureId];
+	const TextureData* Texture = UseTextureData(TextureId);
+	if (!Texture) return;
+
+	//Set the texture rect
+	Rectangle2D<int> TextureRect = Rectangle2D<int>(Vector2D<int>(0, 0), Texture->Size);
+
+	RecordQuad(*Texture, DrawRect, TextureRect, Color, Angle, Flip);
+}
+
+void SDLGraphics::DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const Vector2D<int>& CellPosition, const Color& Color, float Angle, const Flip& Flip)
+{
+	//Get the texture
+	const TextureData* Texture = UseTextureData(TextureId);
 	if (!Texture) return;
 
-	//Set flip
-	SDL_RendererFlip SDLFlip = SDL_FLIP_NONE;
-	if (Flip.Horizontal && Flip.Vertical)
+	Rectangle2D<int> TextureRect = Rectangle2D<int>(Vector2D<int>(CellSize.X * CellPosition.X, CellSize.Y * CellPosition.Y), Vector2D<int>(CellSize.X, CellSize.Y));
+
+	RecordQuad(*Texture, DrawRect, TextureRect, Color, Angle, Flip);
+}
+
+void SDLGraphics::DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const int& CellIndex, const Color& Color, float Angle, const Flip& Flip)
+{
+	//Empty cell
+	if (CellIndex < 0) return;
+
+	//Get the texture
+	const TextureData* Texture = UseTextureData(TextureId);
+	if (!Texture) return;
+
+	// Calculate the number of cells per row in the texture
+	int CellsPerRow = Texture->Size.X / CellSize.X;
+	if (CellsPerRow <= 0) return;
+
+	// Convert the CellIndex to X and Y coordinates
+	Vector2D<int> CellPosition;
+	CellPosition.X = (CellIndex % CellsPerRow) * CellSize.X;
+	CellPosition.Y = (CellIndex / CellsPerRow) * CellSize.Y;
+
+	// Define the texture rect
+	Rectangle2D<int> TextureRect = Rectangle2D<int>(CellPosition, CellSize);
+
+	RecordQuad(*Texture, DrawRect, TextureRect, Color, Angle, Flip);
+}
+
+void SDLGraphics::GetTextureSize(size_t TextureId, Vector2D<int>* Size)
+{
+	//A evict texture keep is size
+	const TextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture || (!Texture->Data.Texture && !Texture->bEvicted)) return;
+
+	*Size = Texture->Data.Size;
+}
+
+void SDLGraphics::UnloadTexture(size_t TextureId)
+{
+	TextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture) return;
+
+	//A texture in loading is drop when the worker finish
+	_PendingTextures.erase(TextureId);
+
+	//The texture can be use by a command not render, destroy it after them
+	if (!Texture->Data.bInAtlas && Texture->Data.Texture)
 	{
-		SDLFlip = (SDL_RendererFlip)(SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL);
+		DrawCommand Command;
+		Command.Type = EDrawCommandType::DrawCommand_DestroyTexture;
+		Command.Texture = Texture->Data;
+		GetRecordList().push_back(Command);
 	}
-	else if (Flip.Horizontal)
+	//The packer dont free a place, the page is free with its last texture
+	if (Texture->Data.Texture && Texture->AtlasPage >= 0)
 	{
-		SDLFlip = SDL_FLIP_HORIZONTAL;
+		AtlasPage& Page = _AtlasPages[Texture->AtlasPage];
+		Page.TextureCount--;
+		if (Page.TextureCount <= 0)
+		{
+			FreeAtlasPage(Texture->AtlasPage);
+		}
 	}
-	else if (Flip.Vertical)
+	if (!Texture->Name.empty())
 	{
-		SDLFlip = SDL_FLIP_VERTICAL;
+		_TextureHandles.erase(Texture->Name);
 	}
+	_Textures.Remove(TextureId);
+}
 
-	//Set the color
-	SDL_SetTextureColorMod(Texture, Color.rgba.R, Color.rgba.G, Color.rgba.B);
-	SDL_SetTextureAlphaMod(Texture, Color.rgba.A);
+void SDLGraphics::AcquireTexture(size_t TextureId)
+{
+	TextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture) return;
 
-	//Set the screen rect
-	SDL_FRect SDLScreenRect = { 0.0f };
-	SDLScreenRect.x = DrawRect.Position.X;
-	SDLScreenRect.y = DrawRect.Position.Y;
-	SDLScreenRect.w = DrawRect.Size.X;
-	SDLScreenRect.h = DrawRect.Size.Y;
+	Texture->RefCount++;
+}
 
-	//Set the texture rect
-	Rectangle2D<int> TextureRect = Rectangle2D<int>(Vector2D<int>(0, 0), Vector2D<int>(0, 0));
-	GetTextureSize(TextureId, &TextureRect.Size);
+void SDLGraphics::ReleaseTexture(size_t TextureId)
+{
+	TextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture || Texture->RefCount <= 0) return;
 
-	SDL_Rect SDLTextureRect = { 0 };
-	SDLTextureRect.x = TextureRect.Position.X;
-	SDLTextureRect.y = TextureRect.Position.Y;
-	SDLTextureRect.w = TextureRect.Size.X;
-	SDLTextureRect.h = TextureRect.Size.Y;
+	//Stay load, evict only if the budget is pass
+	Texture->RefCount--;
+}
 
-	//Draw the texture
-	SDL_RenderCopyExF(_Renderer, Texture, &SDLTextureRect, &SDLScreenRect, Angle, nullptr, SDLFlip);
+void SDLGraphics::SetTextureBudget(size_t Bytes)
+{
+	_TextureBudget = Bytes;
 }
 
-void SDLGraphics::DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const Vector2D<int>& CellPosition, const Color& Color, float Angle, const Flip& Flip)
+std::vector<TextureResidency> SDLGraphics::GetTextureResidency() const
 {
-	//Get the texture
-	SDL_Texture* Texture = _TextureMap[TextureId];
-	if (!Texture) return;
+	std::vector<TextureResidency> Residency;
+	Residency.reserve(_Textures.Size() + _AtlasPages.size());
 
-	//Set the texture flip
-	SDL_RendererFlip SDLFlip = SDL_FLIP_NONE;
-	if (Flip.Horizontal && Flip.Vertical)
+	_Textures.ForEachHandle([&Residency](size_t TextureId, const TextureRecord& Texture)
+	{
+		TextureResidency Entry;
+		Entry.TextureId = TextureId;
+		Entry.Name = Texture.Name;
+		Entry.Size = Texture.Data.Size;
+		Entry.Bytes = GetTextureBytes(Texture.Data);
+		Entry.RefCount = Texture.RefCount;
+		Entry.LastUseFrame = Texture.LastUseFrame;
+		Entry.bResident = Texture.Data.Texture != nullptr;
+		Entry.bInAtlas = Texture.Data.bInAtlas;
+		Residency.push_back(Entry);
+	});
+
+	//The atlas page hold the memory of all the texture in it
+	for (size_t i = 0; i < _AtlasPages.size(); i++)
 	{
-		SDLFlip = (SDL_RendererFlip)(SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL);
+		if (!_AtlasPages[i].Texture) continue;
+
+		TextureResidency Entry;
+		Entry.Name = "Atlas page " + std::to_string(i);
+		Entry.Size = _AtlasPages[i].Packer.GetSize();
+		Entry.Bytes = static_cast<size_t>(Entry.Size.X) * Entry.Size.Y * 4;
+		Entry.RefCount = 1;
+		Entry.LastUseFrame = _FrameIndex;
+		Residency.push_back(Entry);
 	}
-	else if (Flip.Horizontal)
+
+	return Residency;
+}
+
+size_t SDLGraphics::GetTextureBytes(const TextureData& Texture)
+{
+	if (Texture.bInAtlas) return 0;
+	return static_cast<size_t>(Texture.TextureSize.X) * Texture.TextureSize.Y * 4;
+}
+
+//Texture or atlas page that can be evict, with the last frame it is draw
+struct EvictCandidate
+{
+public:
+	size_t LastUseFrame = 0;
+	size_t TextureId = 0;
+	//Page to evict with all its texture, -1 for a texture alone
+	int AtlasPage = -1;
+
+	bool operator<(const EvictCandidate& Other) const { return LastUseFrame < Other.LastUseFrame; }
+};
+
+void SDLGraphics::EvictTextures()
+{
+	if (_TextureBudget == 0) return;
+
+	const size_t PageBytes = static_cast<size_t>(_AtlasPageSize) * _AtlasPageSize * 4;
+
+	//A page can be evict only if all its texture can, its last use is the last use of its texture
+	std::vector<bool> PageCanEvict(_AtlasPages.size(), true);
+	std::vector<size_t> PageLastUse(_AtlasPages.size(), 0);
+
+	//Memory of all the SDL texture
+	size_t ResidentBytes = 0;
+	for (const AtlasPage& Page : _AtlasPages)
 	{
-		SDLFlip = SDL_FLIP_HORIZONTAL;
+		if (Page.Texture) ResidentBytes += PageBytes;
 	}
-	else if (Flip.Vertical)
+
+	std::vector<EvictCandidate> Candidates;
+	_Textures.ForEachHandle([&](size_t TextureId, const TextureRecord& Texture)
+	{
+		if (!Texture.Data.Texture) return;
+		ResidentBytes += GetTextureBytes(Texture.Data);
+
+		//Only a texture with a file can be reload, the one draw this frame are still in the command list
+		bool bCanEvict = !Texture.Name.empty() && Texture.RefCount <= 0 && Texture.LastUseFrame < _FrameIndex;
+		if (Texture.AtlasPage >= 0)
+		{
+			PageCanEvict[Texture.AtlasPage] = PageCanEvict[Texture.AtlasPage] && bCanEvict;
+			PageLastUse[Texture.AtlasPage] = std::max(PageLastUse[Texture.AtlasPage], Texture.LastUseFrame);
+			return;
+		}
+		if (!bCanEvict) return;
+
+		EvictCandidate Candidate;
+		Candidate.LastUseFrame = Texture.LastUseFrame;
+		Candidate.TextureId = TextureId;
+		Candidates.push_back(Candidate);
+	});
+	if (ResidentBytes <= _TextureBudget) return;
+
+	for (size_t i = 0; i < _AtlasPages.size(); i++)
 	{
-		SDLFlip = SDL_FLIP_VERTICAL;
+		if (!_AtlasPages[i].Texture || !PageCanEvict[i]) continue;
+
+		EvictCandidate Candidate;
+		Candidate.LastUseFrame = PageLastUse[i];
+		Candidate.AtlasPage = static_cast<int>(i);
+		Candidates.push_back(Candidate);
 	}
 
-	//Set the color
-	SDL_SetTextureColorMod(Texture, Color.rgba.R, Color.rgba.G, Color.rgba.B);
-	SDL_SetTextureAlphaMod(Texture, Color.rgba.A);
+	//Oldest use first
+	std::sort(Candidates.begin(), Candidates.end());
+	for (const EvictCandidate& Candidate : Candidates)
+	{
+		if (ResidentBytes <= _TextureBudget) break;
 
-	//Set the screen rect
-	SDL_FRect SDLScreenRect = { 0.0f };
-	SDLScreenRect.x = DrawRect.Position.X;
-	SDLScreenRect.y = DrawRect.Position.Y;
-	SDLScreenRect.w = DrawRect.Size.X;
-	SDLScreenRect.h = DrawRect.Size.Y;
+		//All the texture of the page are pack again in a page at there next use
+		if (Candidate.AtlasPage >= 0)
+		{
+			_Textures.ForEach([&Candidate](TextureRecord& Texture)
+			{
+				if (Texture.AtlasPage != Candidate.AtlasPage || !Texture.Data.Texture) return;
+				Texture.Data.Texture = nullptr;
+				Texture.AtlasPage = -1;
+				Texture.bEvicted = true;
+			});
+			FreeAtlasPage(Candidate.AtlasPage);
+			ResidentBytes -= PageBytes;
+			continue;
+		}
 
-	Rectangle2D<int> TextureRect = Rectangle2D<int>(Vector2D<int>(CellSize.X * CellPosition.X, CellSize.Y * CellPosition.Y), Vector2D<int>(CellSize.X, CellSize.Y));
+		TextureRecord* Texture = _Textures.Get(Candidate.TextureId);
+		ResidentBytes -= GetTextureBytes(Texture->Data);
 
-	SDL_Rect SDLTextureRect = { 0 };
-	SDLTextureRect.x = TextureRect.Position.X;
-	SDLTextureRect.y = TextureRect.Position.Y;
-	SDLTextureRect.w = TextureRect.Size.X;
-	SDLTextureRect.h = TextureRect.Size.Y;
+		//Destroy after the command already record with it
+		DrawCommand Command;
+		Command.Type = EDrawCommandType::DrawCommand_DestroyTexture;
+		Command.Texture = Texture->Data;
+		GetRecordList().push_back(Command);
 
-	//Draw the texture
-	SDL_RenderCopyExF(_Renderer, Texture, &SDLTextureRect, &SDLScreenRect, Angle, nullptr, SDLFlip);
+		//The handle and the name stay, the texture is reload at the next use
+		Texture->Data.Texture = nullptr;
+		Texture->bEvicted = true;
+	}
 }
 
-void SDLGraphics::DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const int& CellIndex, const Color& Color, float Angle, const Flip& Flip)
+void SDLGraphics::FreeAtlasPage(int PageIndex)
 {
-	//Get the texture
-	SDL_Texture* Texture = _TextureMap[TextureId];
-	if (!Texture) return;
+	AtlasPage& Page = _AtlasPages[PageIndex];
+	if (!Page.Texture) return;
 
-	// Calculate the number of cells per row in the texture
-	int CellsPerRow;
-	Vector2D<int> TextureSize;
-	GetTextureSize(TextureId, &TextureSize);
-	CellsPerRow = TextureSize.X / CellSize.X;
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_DestroyTexture;
+	Command.Texture.Texture = Page.Texture;
+	GetRecordList().push_back(Command);
 
-	// Convert the CellIndex to X and Y coordinates
-	Vector2D<int> CellPosition;
-	CellPosition.X = (CellIndex % CellsPerRow) * CellSize.X;
-	CellPosition.Y = (CellIndex / CellsPerRow) * CellSize.Y;
+	Page.Texture = nullptr;
+	Page.Packer = MaxRectsPacker(Page.Packer.GetSize());
+	Page.TextureCount = 0;
+}
 
-	//Set the texture flip
-	SDL_RendererFlip SDLFlip = SDL_FLIP_NONE;
-	if (Flip.Horizontal && Flip.Vertical)
-	{
-		SDLFlip = (SDL_RendererFlip)(SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL);
-	}
-	else if (Flip.Horizontal)
+size_t SDLGraphics::CreateRenderTexture(const Vector2D<int>& Size)
+{
+	SDL_Texture* Texture = nullptr;
+	//The SDL error is by thread, copy it on the render thread
+	std::string Error;
+	RunOnRenderThread([&]()
 	{
-		SDLFlip = SDL_FLIP_HORIZONTAL;
-	}
-	else if (Flip.Vertical)
+		Texture = SDL_CreateTexture(_Renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, Size.X, Size.Y);
+		if (Texture)
+		{
+			SDL_SetTextureBlendMode(Texture, SDL_BLENDMODE_BLEND);
+		}
+		else
+		{
+			Error = SDL_GetError();
+		}
+	});
+	if (!Texture)
 	{
-		SDLFlip = SDL_FLIP_VERTICAL;
+		Engine::GetLogger()->LogMessage(Error.c_str());
+		return 0;
 	}
 
-	//Set the color
-	SDL_SetTextureColorMod(Texture, Color.rgba.R, Color.rgba.G, Color.rgba.B);
-	SDL_SetTextureAlphaMod(Texture, Color.rgba.A);
+	TextureRecord Record;
+	Record.Data.Texture = Texture;
+	Record.Data.Size = Size;
+	Record.Data.TextureSize = Size;
 
-	//Set the screen rect
-	SDL_FRect SDLScreenRect = { 0.0f };
-	SDLScreenRect.x = DrawRect.Position.X;
-	SDLScreenRect.y = DrawRect.Position.Y;
-	SDLScreenRect.w = DrawRect.Size.X;
-	SDLScreenRect.h = DrawRect.Size.Y;
+	return _Textures.Add(Record);
+}
 
-	// Define the texture rect
-	SDL_Rect SDLTextureRect = { CellPosition.X, CellPosition.Y, CellSize.X, CellSize.Y };
+bool SDLGraphics::BeginDrawToTexture(size_t TextureId)
+{
+	const TextureData* Texture = GetTextureData(TextureId);
+	if (!Texture || Texture->bInAtlas) return false;
 
-	//Draw the texture
-	SDL_RenderCopyExF(_Renderer, Texture, &SDLTextureRect, &SDLScreenRect, Angle, nullptr, SDLFlip);
+	//The texture is clear when the target change
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_SetTarget;
+	Command.Texture = *Texture;
+	GetRecordList().push_back(Command);
+
+	_bDrawToTexture = true;
+
+	return true;
 }
 
-void SDLGraphics::GetTextureSize(size_t TextureId, Vector2D<int>* Size)
+void SDLGraphics::EndDrawToTexture()
 {
-	SDL_Texture* Texture = _TextureMap[TextureId];
-	if (!Texture) return;
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_SetTarget;
+	GetRecordList().push_back(Command);
 
-	SDL_QueryTexture(Texture, NULL, NULL, &Size->X, &Size->Y);
+	_bDrawToTexture = false;
 }
 
-size_t SDLGraphics::LoadFont(const std::string& Filename, int FontSize)
+const TextureData* SDLGraphics::GetTextureData(size_t TextureId) const
+{
+	const TextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture || !Texture->Data.Texture) return nullptr;
+	return &Texture->Data;
+}
+
+const TextureData* SDLGraphics::UseTextureData(size_t TextureId)
 {
-	//Get ID
-	std::hash<std::string> Hasher;
-	size_t FontId = Hasher(Filename);
+	TextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture) return nullptr;
 
-	//Load font
-	if (_FontMap.find(FontId) == _FontMap.end())
+	Texture->LastUseFrame = _FrameIndex;
+	if (Texture->bEvicted)
 	{
-		std::string FilePath = "./Assets/Font/";
-		FilePath += Filename;
+		//Draw nothing until the reload finish
+		ReloadTexture(TextureId);
+		return nullptr;
+	}
 
-		TTF_Font* Font = TTF_OpenFont(FilePath.c_str(), FontSize);
-		if (Font)
+	if (!Texture->Data.Texture) return nullptr;
+	return &Texture->Data;
+}
+
+//Return true if the two rect overlap
+static bool RectOverlap(const Rectangle2D<float>& A, const Rectangle2D<float>& B)
+{
+	return A.Position.X < B.Position.X + B.Size.X && B.Position.X < A.Position.X + A.Size.X
+		&& A.Position.Y < B.Position.Y + B.Size.Y && B.Position.Y < A.Position.Y + A.Size.Y;
+}
+
+void SDLGraphics::RecordQuad(const TextureData& Texture, const Rectangle2D<float>& WorldRect, const Rectangle2D<int>& SourceRect, const Color& Color, float Angle, const Flip& Flip)
+{
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_Quad;
+	Command.Texture = Texture;
+	Command.Rect = WorldToScreen(WorldRect);
+	Command.SourceRect = SourceRect;
+	Command.Color = Color.rgba;
+	Command.Angle = Angle;
+	Command.TextureFlip = Flip;
+	GetRecordList().push_back(Command);
+
+	GetRecordStats().QuadsSubmitted++;
+}
+
+void SDLGraphics::PushQuad(const DrawCommand& Command)
+{
+	const TextureData& Texture = Command.Texture;
+	const Rectangle2D<float>& DrawRect = Command.Rect;
+	const Rectangle2D<int>& SourceRect = Command.SourceRect;
+	float Angle = Command.Angle;
+
+	//Texture coordinate, in the atlas page if the texture is in one
+	float InvWidth = 1.0f / static_cast<float>(Texture.TextureSize.X);
+	float InvHeight = 1.0f / static_cast<float>(Texture.TextureSize.Y);
+	float U0 = static_cast<float>(Texture.Offset.X + SourceRect.Position.X) * InvWidth;
+	float V0 = static_cast<float>(Texture.Offset.Y + SourceRect.Position.Y) * InvHeight;
+	float U1 = static_cast<float>(Texture.Offset.X + SourceRect.Position.X + SourceRect.Size.X) * InvWidth;
+	float V1 = static_cast<float>(Texture.Offset.Y + SourceRect.Position.Y + SourceRect.Size.Y) * InvHeight;
+	if (Command.TextureFlip.Horizontal) std::swap(U0, U1);
+	if (Command.TextureFlip.Vertical) std::swap(V0, V1);
+
+	//Corner relative to the center, in order top left, top right, bottom right, bottom left
+	Vector2D<float> HalfSize = Vector2D<float>(DrawRect.Size.X * 0.5f, DrawRect.Size.Y * 0.5f);
+	Vector2D<float> Center = Vector2D<float>(DrawRect.Position.X + HalfSize.X, DrawRect.Position.Y + HalfSize.Y);
+	Vector2D<float> Corners[4] = {
+		Vector2D<float>(-HalfSize.X, -HalfSize.Y),
+		Vector2D<float>(HalfSize.X, -HalfSize.Y),
+		Vector2D<float>(HalfSize.X, HalfSize.Y),
+		Vector2D<float>(-HalfSize.X, HalfSize.Y)
+	};
+	Vector2D<float> UVs[4] = {
+		Vector2D<float>(U0, V0),
+		Vector2D<float>(U1, V0),
+		Vector2D<float>(U1, V1),
+		Vector2D<float>(U0, V1)
+	};
+
+	//Rotate clockwise in degree like SDL_RenderCopyEx
+	Rectangle2D<float> Bounds = DrawRect;
+	if (Angle != 0.0f)
+	{
+		float Radian = Angle * static_cast<float>(M_PI) / 180.0f;
+		float Cos = cos(Radian);
+		float Sin = sin(Radian);
+		for (Vector2D<float>& Corner : Corners)
 		{
-			_FontMap[FontId] = Font;
+			Corner = Vector2D<float>(Corner.X * Cos - Corner.Y * Sin, Corner.X * Sin + Corner.Y * Cos);
 		}
-		else
+
+		float ExtentX = fabs(HalfSize.X * Cos) + fabs(HalfSize.Y * Sin);
+		float ExtentY = fabs(HalfSize.X * Sin) + fabs(HalfSize.Y * Cos);
+		Bounds = Rectangle2D<float>(Vector2D<float>(Center.X - ExtentX, Center.Y - ExtentY), Vector2D<float>(ExtentX * 2.0f, ExtentY * 2.0f));
+	}
+
+	BatchRun& Run = GetBatchRun(Texture.Texture, Bounds);
+
+	//Grow the run bounds
+	if (Run.Vertices.empty())
+	{
+		Run.Bounds = Bounds;
+	}
+	else
+	{
+		float MinX = std::min(Run.Bounds.Position.X, Bounds.Position.X);
+		float MinY = std::min(Run.Bounds.Position.Y, Bounds.Position.Y);
+		float MaxX = std::max(Run.Bounds.Position.X + Run.Bounds.Size.X, Bounds.Position.X + Bounds.Size.X);
+		float MaxY = std::max(Run.Bounds.Position.Y + Run.Bounds.Size.Y, Bounds.Position.Y + Bounds.Size.Y);
+		Run.Bounds = Rectangle2D<float>(Vector2D<float>(MinX, MinY), Vector2D<float>(MaxX - MinX, MaxY - MinY));
+	}
+
+	//Add the vertex
+	for (int i = 0; i < 4; i++)
+	{
+		BatchVertex Vertex;
+		Vertex.Position = Vector2D<float>(Center.X + Corners[i].X, Center.Y + Corners[i].Y);
+		Vertex.Color = Command.Color;
+		Vertex.UV = UVs[i];
+		Run.Vertices.push_back(Vertex);
+	}
+}
+
+BatchRun& SDLGraphics::GetBatchRun(SDL_Texture* Texture, const Rectangle2D<float>& Bounds)
+{
+	//Number of run check back before open a new one
+	const size_t MaxRunLookBack = 16;
+
+	//A quad can join a older run with the same texture only if it dont overlap any run draw after it
+	size_t LookBack = 0;
+	for (size_t i = _BatchRunCount; i > 0 && LookBack < MaxRunLookBack; i--, LookBack++)
+	{
+		BatchRun& CurrRun = _BatchRuns[i - 1];
+		if (CurrRun.Texture == Texture)
+		{
+			return CurrRun;
+		}
+		if (RectOverlap(CurrRun.Bounds, Bounds))
+		{
+			break;
+		}
+	}
+
+	//Open a new run, reuse the old vector memory
+	if (_BatchRunCount == _BatchRuns.size())
+	{
+		_BatchRuns.emplace_back();
+	}
+	BatchRun& NewRun = _BatchRuns[_BatchRunCount++];
+	NewRun.Texture = Texture;
+	NewRun.Vertices.clear();
+	return NewRun;
+}
+
+void SDLGraphics::FlushBatch()
+{
+	bool bDrawRun = false;
+	for (size_t i = 0; i < _BatchRunCount; i++)
+	{
+		BatchRun& CurrRun = _BatchRuns[i];
+		int QuadCount = static_cast<int>(CurrRun.Vertices.size() / 4);
+		if (QuadCount == 0) continue;
+
+		GrowBatchIndices(QuadCount);
+
+		if (CurrRun.Texture != _BoundTexture)
 		{
-			Engine::GetLogger()->LogMessage(TTF_GetError());
+			_ExecuteStats->TextureBinds++;
+			_BoundTexture = CurrRun.Texture;
 		}
+		_ExecuteStats->DrawCalls++;
+		bDrawRun = true;
+
+		const BatchVertex* Vertices = CurrRun.Vertices.data();
+		const int Stride = static_cast<int>(sizeof(BatchVertex));
+		SDL_RenderGeometryRaw(_Renderer, CurrRun.Texture,
+			&Vertices->Position.X, Stride,
+			reinterpret_cast<const SDL_Color*>(&Vertices->Color), Stride,
+			&Vertices->UV.X, Stride,
+			static_cast<int>(CurrRun.Vertices.size()),
+			_BatchIndices.data(), QuadCount * 6, sizeof(int));
+
+		CurrRun.Vertices.clear();
+	}
+	_BatchRunCount = 0;
+
+	if (bDrawRun)
+	{
+		_ExecuteStats->BatchesFlushed++;
+	}
+}
+
+void SDLGraphics::GrowBatchIndices(size_t QuadCount)
+{
+	//Same index for all run and line batch
+	while (_BatchIndices.size() < QuadCount * 6)
+	{
+		int FirstVertex = static_cast<int>(_BatchIndices.size() / 6) * 4;
+		_BatchIndices.push_back(FirstVertex);
+		_BatchIndices.push_back(FirstVertex + 1);
+		_BatchIndices.push_back(FirstVertex + 2);
+		_BatchIndices.push_back(FirstVertex);
+		_BatchIndices.push_back(FirstVertex + 2);
+		_BatchIndices.push_back(FirstVertex + 3);
+	}
+}
+
+void SDLGraphics::DrawLineBatch(const std::vector<DebugLine>& Lines, size_t First, size_t Count)
+{
+	if (First + Count > Lines.size()) return;
+
+	_LineVertices.clear();
+	for (size_t i = First; i < First + Count; i++)
+	{
+		const DebugLine& CurrLine = Lines[i];
+
+		//Half pixel on each side of the line
+		float DirectionX = CurrLine.End.X - CurrLine.Start.X;
+		float DirectionY = CurrLine.End.Y - CurrLine.Start.Y;
+		float Length = std::sqrt(DirectionX * DirectionX + DirectionY * DirectionY);
+		Vector2D<float> Normal = Length > 0.0f ? Vector2D<float>(-DirectionY / Length * 0.5f, DirectionX / Length * 0.5f) : Vector2D<float>(0.5f, 0.5f);
+
+		BatchVertex Vertex;
+		Vertex.Color = CurrLine.Color;
+		Vertex.Position = Vector2D<float>(CurrLine.Start.X + Normal.X, CurrLine.Start.Y + Normal.Y);
+		_LineVertices.push_back(Vertex);
+		Vertex.Position = Vector2D<float>(CurrLine.End.X + Normal.X, CurrLine.End.Y + Normal.Y);
+		_LineVertices.push_back(Vertex);
+		Vertex.Position = Vector2D<float>(CurrLine.End.X - Normal.X, CurrLine.End.Y - Normal.Y);
+		_LineVertices.push_back(Vertex);
+		Vertex.Position = Vector2D<float>(CurrLine.Start.X - Normal.X, CurrLine.Start.Y - Normal.Y);
+		_LineVertices.push_back(Vertex);
 	}
 
+	GrowBatchIndices(Count);
+
+	_ExecuteStats->DrawCalls++;
+	_BoundTexture = nullptr;
+
+	const BatchVertex* Vertices = _LineVertices.data();
+	const int Stride = static_cast<int>(sizeof(BatchVertex));
+	SDL_RenderGeometryRaw(_Renderer, nullptr,
+		&Vertices->Position.X, Stride,
+		reinterpret_cast<const SDL_Color*>(&Vertices->Color), Stride,
+		&Vertices->UV.X, Stride,
+		static_cast<int>(_LineVertices.size()),
+		_BatchIndices.data(), static_cast<int>(Count) * 6, sizeof(int));
+}
+
+size_t SDLGraphics::LoadFont(const std::string& Filename, int FontSize)
+{
+	//The same font can be load at many size
+	std::string FontName = Filename + ":" + std::to_string(FontSize);
+	auto IT = _FontHandles.find(FontName);
+	if (IT != _FontHandles.end()) return IT->second;
+
+	//Load font
+	std::string FilePath = "./Assets/Font/";
+	FilePath += Filename;
+
+	TTF_Font* Font = TTF_OpenFont(FilePath.c_str(), FontSize);
+	if (!Font)
+	{
+		Engine::GetLogger()->LogMessage(TTF_GetError());
+		return 0;
+	}
+
+	FontData Data;
+	Data.Font = Font;
+	size_t FontId = _Fonts.Add(Data);
+	_FontHandles[FontName] = FontId;
+
 	return FontId;
 }
 
 void SDLGraphics::DrawString(size_t FontId, const char* Text, const Vector2D<int>& Location, const Color& Color)
 {
-	//Get the font
-	TTF_Font* Font = _FontMap[FontId];
-	if (!Font) return;
-
-	//Set the color
-	SDL_Color SDLColor = SDL_Color();
-	SDLColor.r = Color.rgba.R;
-	SDLColor.g = Color.rgba.G;
-	SDLColor.b = Color.rgba.B;
-	SDLColor.a = Color.rgba.A;
-
-	//Create surface contain the text with font and color
-	SDL_Surface* Surface = TTF_RenderText_Solid(Font, Text, SDLColor);
-	//Create texture with the surface
-	SDL_Texture* TextureBuffer = SDL_CreateTextureFromSurface(_Renderer, Surface);
-
-	//Get the render text size
-	Vector2D<int> FontSize;
-	GetTextSize(FontId, Text, &FontSize);
-
-	//Set the screen rect
-	SDL_Rect SDLRect = SDL_Rect();
-	SDLRect.x = Location.X;
-	SDLRect.y = Location.Y;
-	SDLRect.w = FontSize.X;
-	SDLRect.h = FontSize.Y;
-
-	//Draw font
-	SDL_RenderCopy(_Renderer, TextureBuffer, nullptr, &SDLRect);
-	SDL_FreeSurface(Surface);
-	SDL_DestroyTexture(TextureBuffer);
+	const TextLayout* Layout = GetTextLayout(FontId, Text);
+	if (!Layout) return;
+
+	const FontData& Font = *_Fonts.Get(FontId);
+
+	//Each glyph is a quad from the font page, the color is apply on the white glyph
+	for (const TextGlyph& CurrGlyph : Layout->Glyphs)
+	{
+		TextureData PageData;
+		PageData.Texture = Font.Pages[CurrGlyph.Page].Texture;
+		PageData.Size = Font.Pages[CurrGlyph.Page].Packer.GetSize();
+		PageData.TextureSize = PageData.Size;
+
+		Rectangle2D<float> DrawRect = Rectangle2D<float>(
+			Vector2D<float>(static_cast<float>(Location.X + CurrGlyph.Offset.X), static_cast<float>(Location.Y + CurrGlyph.Offset.Y)),
+			Vector2D<float>(static_cast<float>(CurrGlyph.Rect.Size.X), static_cast<float>(CurrGlyph.Rect.Size.Y)));
+
+		RecordQuad(PageData, DrawRect, CurrGlyph.Rect, Color, 0.0f, Flip());
+	}
 }
 
 void SDLGraphics::GetTextSize(size_t FontId, const char* Text, Vector2D<int>* Size)
 {
-	TTF_Font* Font = _FontMap[FontId];
-	if (!Font) return;
+	const TextLayout* Layout = GetTextLayout(FontId, Text);
+	if (!Layout) return;
+
+	*Size = Layout->Size;
+}
+
+const GlyphData* SDLGraphics::GetGlyph(FontData& Font, unsigned int Character)
+{
+	auto IT = Font.Glyphs.find(Character);
+	if (IT != Font.Glyphs.end()) return &IT->second;
 
-	int Width = 0;
-	int Height = 0;
-	if (TTF_SizeText(Font, Text, &Width, &Height) != 0) return;
+	GlyphData Glyph;
 
-	Size->X = Width;
-	Size->Y = Height;
+	int MinX = 0, MaxX = 0, MinY = 0, MaxY = 0;
+	if (TTF_GlyphMetrics32(Font.Font, Character, &MinX, &MaxX, &MinY, &MaxY, &Glyph.Advance) != 0)
+	{
+		Glyph.Advance = 0;
+	}
+
+	//Render the glyph in white, the color is set when draw
+	SDL_Color White = { 255, 255, 255, 255 };
+	SDL_Surface* Surface = TTF_RenderGlyph32_Blended(Font.Font, Character, White);
+	GetRecordStats().TextRasterizations++;
+	if (Surface && Surface->w > 0 && Surface->h > 0)
+	{
+		Vector2D<int> PackSize = Vector2D<int>(Surface->w + _AtlasPadding, Surface->h + _AtlasPadding);
+		Rectangle2D<int> PackRect = Rectangle2D<int>(Vector2D<int>(0, 0), Vector2D<int>(0, 0));
+
+		//Find a page with place or create one
+		int PageIndex = -1;
+		for (int i = 0; i < static_cast<int>(Font.Pages.size()); i++)
+		{
+			if (Font.Pages[i].Packer.Insert(PackSize, &PackRect))
+			{
+				PageIndex = i;
+				break;
+			}
+		}
+		if (PageIndex == -1)
+		{
+			SDL_Texture* PageTexture = nullptr;
+			std::string Error;
+			RunOnRenderThread([&]()
+			{
+				PageTexture = SDL_CreateTexture(_Renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, _GlyphPageSize, _GlyphPageSize);
+				if (!PageTexture)
+				{
+					Error = SDL_GetError();
+					return;
+				}
+				SDL_SetTextureBlendMode(PageTexture, SDL_BLENDMODE_BLEND);
+				std::vector<Uint32> ClearPixels(static_cast<size_t>(_GlyphPageSize) * _GlyphPageSize, 0);
+				SDL_UpdateTexture(PageTexture, nullptr, ClearPixels.data(), _GlyphPageSize * sizeof(Uint32));
+			});
+			if (PageTexture)
+			{
+
+				Font.Pages.emplace_back(PageTexture, Vector2D<int>(_GlyphPageSize, _GlyphPageSize));
+				if (Font.Pages.back().Packer.Insert(PackSize, &PackRect))
+				{
+					PageIndex = static_cast<int>(Font.Pages.size()) - 1;
+				}
+			}
+			else
+			{
+				Engine::GetLogger()->LogMessage(Error.c_str());
+			}
+		}
+
+		//Copy the glyph in the page
+		SDL_Surface* Converted = PageIndex != -1 ? SDL_ConvertSurfaceFormat(Surface, SDL_PIXELFORMAT_RGBA32, 0) : nullptr;
+		if (Converted)
+		{
+			SDL_Rect SDLRect = { PackRect.Position.X, PackRect.Position.Y, Surface->w, Surface->h };
+			SDL_Texture* PageTexture = Font.Pages[PageIndex].Texture;
+			RunOnRenderThread([&]() { SDL_UpdateTexture(PageTexture, &SDLRect, Converted->pixels, Converted->pitch); });
+			SDL_FreeSurface(Converted);
+
+			Glyph.Page = PageIndex;
+			Glyph.Rect = Rectangle2D<int>(PackRect.Position, Vector2D<int>(Surface->w, Surface->h));
+		}
+	}
+	SDL_FreeSurface(Surface);
+
+	//Glyph without pixel, like space, is keep only for is advance
+	return &(Font.Glyphs[Character] = Glyph);
+}
+
+const TextLayout* SDLGraphics::GetTextLayout(size_t FontId, const char* Text)
+{
+	FontData* FoundFont = _Fonts.Get(FontId);
+	if (!FoundFont || !FoundFont->Font || !Text) return nullptr;
+	FontData& Font = *FoundFont;
+
+	//Find the layout with the text hash
+	std::hash<std::string_view> Hasher;
+	size_t TextHash = Hasher(std::string_view(Text));
+	auto LayoutIT = Font.Layouts.find(TextHash);
+	if (LayoutIT != Font.Layouts.end() && LayoutIT->second.Text == Text)
+	{
+		return &LayoutIT->second;
+	}
+
+	//Too many text, like a timer, start again
+	if (Font.Layouts.size() >= _MaxTextLayout)
+	{
+		Font.Layouts.clear();
+	}
+
+	//Place all glyph, one byte is one character like TTF_RenderText
+	TextLayout Layout;
+	Layout.Text = Text;
+	Layout.Size.Y = TTF_FontHeight(Font.Font);
+
+	int PenX = 0;
+	unsigned int PreviousCharacter = 0;
+	for (const char* CurrChar = Text; *CurrChar; CurrChar++)
+	{
+		unsigned int Character = static_cast<unsigned char>(*CurrChar);
+
+		if (PreviousCharacter != 0)
+		{
+			PenX += TTF_GetFontKerningSizeGlyphs32(Font.Font, PreviousCharacter, Character);
+		}
+
+		const GlyphData* Glyph = GetGlyph(Font, Character);
+		if (Glyph->Page != -1)
+		{
+			TextGlyph NewGlyph;
+			NewGlyph.Page = Glyph->Page;
+			NewGlyph.Rect = Glyph->Rect;
+			NewGlyph.Offset = Vector2D<int>(PenX, 0);
+			Layout.Glyphs.push_back(NewGlyph);
+
+			Layout.Size.X = std::max(Layout.Size.X, PenX + Glyph->Rect.Size.X);
+		}
+		PenX += Glyph->Advance;
+		PreviousCharacter = Character;
+	}
+	Layout.Size.X = std::max(Layout.Size.X, PenX);
+
+	return &(Font.Layouts[TextHash] = std::move(Layout));
 }
 
 Vector2D<int> SDLGraphics::GetScreenSize() const
@@ -369,48 +1018,554 @@ Vector2D<int> SDLGraphics::GetScreenSize() const
 
 bool SDLGraphics::CheckPointIsOutOfScreen(const Vector2D<float>& Point) const
 {
-	Vector2D<int> ScreenSize = GetScreenSize();
-	Vector2D<float> FScreenSize = Vector2D<float>(static_cast<float>(ScreenSize.X), static_cast<float>(ScreenSize.Y));
+	Rectangle2D<int> Viewport = GetViewport();
+	Vector2D<float> ScreenPoint = WorldToScreen(Point);
 
-	if (Point.X < 0 || Point.Y < 0 || Point.X > FScreenSize.X || Point.Y > FScreenSize.Y)
+	if (ScreenPoint.X < Viewport.Position.X || ScreenPoint.Y < Viewport.Position.Y
+		|| ScreenPoint.X > Viewport.Position.X + Viewport.Size.X || ScreenPoint.Y > Viewport.Position.Y + Viewport.Size.Y)
 	{
 		return true;
 	}
 	return false;
 }
 
+void SDLGraphics::SetCamera(const Camera& NewCamera)
+{
+	_Camera = NewCamera;
+	if (_Camera.Zoom <= 0.0f)
+	{
+		_Camera.Zoom = 1.0f;
+	}
+
+	//Only draw in the viewport
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_SetClip;
+	Command.SourceRect = _Camera.Viewport;
+	Command.bFlag = _Camera.Viewport.Size.X > 0 && _Camera.Viewport.Size.Y > 0;
+	GetRecordList().push_back(Command);
+}
+
+Rectangle2D<float> SDLGraphics::GetViewRect() const
+{
+	Rectangle2D<int> Viewport = GetViewport();
+	Vector2D<float> Size = Vector2D<float>(Viewport.Size.X / _Camera.Zoom, Viewport.Size.Y / _Camera.Zoom);
+
+	return Rectangle2D<float>(_Camera.Position, Size);
+}
+
+void SDLGraphics::SetScreenSpace(bool bScreenSpace)
+{
+	_bScreenSpace = bScreenSpace;
+}
+
+Rectangle2D<int> SDLGraphics::GetViewport() const
+{
+	if (_Camera.Viewport.Size.X > 0 && _Camera.Viewport.Size.Y > 0)
+	{
+		return _Camera.Viewport;
+	}
+	return Rectangle2D<int>(Vector2D<int>(0, 0), GetScreenSize());
+}
+
+bool SDLGraphics::UseCamera() const
+{
+	return !_bScreenSpace && !_bDrawToTexture;
+}
+
+Vector2D<float> SDLGraphics::WorldToScreen(const Vector2D<float>& Position) const
+{
+	if (!UseCamera()) return Position;
+
+	Rectangle2D<int> Viewport = GetViewport();
+	return Vector2D<float>(
+		Viewport.Position.X + (Position.X - _Camera.Position.X) * _Camera.Zoom,
+		Viewport.Position.Y + (Position.Y - _Camera.Position.Y) * _Camera.Zoom);
+}
+
+Rectangle2D<float> SDLGraphics::WorldToScreen(const Rectangle2D<float>& Rect) const
+{
+	if (!UseCamera()) return Rect;
+
+	return Rectangle2D<float>(WorldToScreen(Rect.Position), Vector2D<float>(Rect.Size.X * _Camera.Zoom, Rect.Size.Y * _Camera.Zoom));
+}
+
 void SDLGraphics::Clear()
 {
-	SDL_SetRenderDrawColor(_Renderer, _BackgroundColor.rgba.R, _BackgroundColor.rgba.G, _BackgroundColor.rgba.B, _BackgroundColor.rgba.A);
-	SDL_RenderClear(_Renderer);
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_Clear;
+	Command.Color = _BackgroundColor.rgba;
+	GetRecordList().push_back(Command);
 }
 
 void SDLGraphics::Present()
 {
-	SDL_RenderPresent(_Renderer);
+	//Before the present command, the destroy are after all draw of the frame
+	EvictTextures();
+	_FrameIndex++;
+
+	DrawCommand Command;
+	Command.Type = EDrawCommandType::DrawCommand_Present;
+	GetRecordList().push_back(Command);
+
+	//No render thread, render now
+	if (!_bUseRenderThread)
+	{
+		ExecuteCommands(GetRecordList(), GetRecordLines(), GetRecordStats());
+		GetRecordList().clear();
+		GetRecordLines().clear();
+		PublishFrameStats(GetRecordStats());
+		GetRecordStats() = FrameStats();
+		return;
+	}
+
+	//Wait the last frame is render, only one frame in flight, then send this one
+	std::unique_lock<std::mutex> Lock(_RenderMutex);
+	_RenderCondition.wait(Lock, [this]() { return _SubmitList == nullptr; });
+	//The counter of the last frame are complete now
+	PublishFrameStats(_ListStats[1 - _RecordListIndex]);
+	_SubmitList = &GetRecordList();
+	_SubmitLines = &GetRecordLines();
+	_SubmitStats = &GetRecordStats();
+	_RecordListIndex = 1 - _RecordListIndex;
+	GetRecordStats() = FrameStats();
+	Lock.unlock();
+	_RenderCondition.notify_all();
+}
+
+void SDLGraphics::RunOnRenderThread(const std::function<void()>& Function)
+{
+	if (!_bUseRenderThread || std::this_thread::get_id() == _RenderThreadId)
+	{
+		Function();
+		return;
+	}
+
+	bool bDone = false;
+	std::unique_lock<std::mutex> Lock(_RenderMutex);
+	RenderTask NewTask;
+	NewTask.Function = Function;
+	NewTask.bDone = &bDone;
+	_RenderTasks.push_back(NewTask);
+	_RenderCondition.notify_all();
+	_RenderCondition.wait(Lock, [&bDone]() { return bDone; });
+}
+
+void SDLGraphics::RenderThreadLoop()
+{
+	PROFILE_THREAD("Render");
+
+	std::unique_lock<std::mutex> Lock(_RenderMutex);
+	while (true)
+	{
+		_RenderCondition.wait(Lock, [this]() { return _bStopRenderThread || !_RenderTasks.empty() || _SubmitList; });
+
+		//Task first, the game thread wait for them
+		if (!_RenderTasks.empty())
+		{
+			RenderTask CurrTask = _RenderTasks.front();
+			_RenderTasks.pop_front();
+			Lock.unlock();
+			CurrTask.Function();
+			Lock.lock();
+			*CurrTask.bDone = true;
+			_RenderCondition.notify_all();
+			continue;
+		}
+
+		if (_SubmitList)
+		{
+			std::vector<DrawCommand>* CurrList = _SubmitList;
+			std::vector<DebugLine>* CurrLines = _SubmitLines;
+			FrameStats* CurrStats = _SubmitStats;
+			Lock.unlock();
+			ExecuteCommands(*CurrList, *CurrLines, *CurrStats);
+			CurrList->clear();
+			CurrLines->clear();
+			Lock.lock();
+			_SubmitList = nullptr;
+			_SubmitLines = nullptr;
+			_SubmitStats = nullptr;
+			_RenderCondition.notify_all();
+			continue;
+		}
+
+		if (_bStopRenderThread) break;
+	}
+}
+
+void SDLGraphics::ExecuteCommands(const std::vector<DrawCommand>& Commands, const std::vector<DebugLine>& Lines, FrameStats& Stats)
+{
+	PROFILE_ZONE("SDLGraphics::ExecuteCommands");
+	_ExecuteStats = &Stats;
+	_BoundTexture = nullptr;
+
+	for (const DrawCommand& Command : Commands)
+	{
+		//Quad are batch, all other command draw the batch before
+		if (Command.Type == EDrawCommandType::DrawCommand_Quad)
+		{
+			PushQuad(Command);
+			continue;
+		}
+		FlushBatch();
+
+		SDL_SetRenderDrawColor(_Renderer, Command.Color.R, Command.Color.G, Command.Color.B, Command.Color.A);
+
+		switch (Command.Type)
+		{
+		case EDrawCommandType::DrawCommand_Rect:
+		{
+			SDL_FRect SDLRect = { Command.Rect.Position.X, Command.Rect.Position.Y, Command.Rect.Size.X, Command.Rect.Size.Y };
+			if (Command.bFlag)
+			{
+				SDL_RenderFillRectF(_Renderer, &SDLRect);
+			}
+			else
+			{
+				SDL_RenderDrawRectF(_Renderer, &SDLRect);
+			}
+			Stats.DrawCalls++;
+			break;
+		}
+		case EDrawCommandType::DrawCommand_Line:
+			SDL_RenderDrawLineF(_Renderer, Command.Rect.Position.X, Command.Rect.Position.Y, Command.Rect.Size.X, Command.Rect.Size.Y);
+			Stats.DrawCalls++;
+			break;
+		case EDrawCommandType::DrawCommand_Point:
+			SDL_RenderDrawPointF(_Renderer, Command.Rect.Position.X, Command.Rect.Position.Y);
+			Stats.DrawCalls++;
+			break;
+		case EDrawCommandType::DrawCommand_Circle:
+		{
+			//Closed line on the unit circle table, no sin and cos per point
+			const std::array<Vector2D<float>, DebugCircleSegments + 1>& UnitCircle = DebugDraw::GetUnitCircle();
+			SDL_FPoint Points[DebugCircleSegments + 1];
+			for (int i = 0; i <= DebugCircleSegments; i++)
+			{
+				Points[i].x = Command.Rect.Position.X + Command.Rect.Size.X * UnitCircle[i].X;
+				Points[i].y = Command.Rect.Position.Y + Command.Rect.Size.X * UnitCircle[i].Y;
+			}
+			SDL_RenderDrawLinesF(_Renderer, Points, DebugCircleSegments + 1);
+			Stats.DrawCalls++;
+			break;
+		}
+		case EDrawCommandType::DrawCommand_Lines:
+			DrawLineBatch(Lines, static_cast<size_t>(Command.SourceRect.Position.X), static_cast<size_t>(Command.SourceRect.Size.X));
+			break;
+		case EDrawCommandType::DrawCommand_SetTarget:
+			_BoundTexture = nullptr;
+			if (SDL_SetRenderTarget(_Renderer, Command.Texture.Texture) != 0)
+			{
+				Engine::GetLogger()->LogMessage(SDL_GetError());
+			}
+			else if (Command.Texture.Texture)
+			{
+				//Clear with transparent
+				SDL_SetRenderDrawColor(_Renderer, 0, 0, 0, 0);
+				SDL_RenderClear(_Renderer);
+			}
+			break;
+		case EDrawCommandType::DrawCommand_SetClip:
+		{
+			SDL_Rect ClipRect = { Command.SourceRect.Position.X, Command.SourceRect.Position.Y, Command.SourceRect.Size.X, Command.SourceRect.Size.Y };
+			SDL_RenderSetClipRect(_Renderer, Command.bFlag ? &ClipRect : nullptr);
+			break;
+		}
+		case EDrawCommandType::DrawCommand_Clear:
+			SDL_RenderClear(_Renderer);
+			break;
+		case EDrawCommandType::DrawCommand_DestroyTexture:
+			SDL_DestroyTexture(Command.Texture.Texture);
+			break;
+		case EDrawCommandType::DrawCommand_Present:
+		{
+			Uint64 PresentStart = SDL_GetPerformanceCounter();
+			SDL_RenderPresent(_Renderer);
+			Stats.PresentTime += static_cast<double>(SDL_GetPerformanceCounter() - PresentStart) * 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	_ExecuteStats = nullptr;
 }
 
 size_t SDLGraphics::LoadTexture(const std::string& Filename)
 {
-	//Get the ID
-	std::hash<std::string> Hasher;
-	size_t TextureId = Hasher(Filename);
+	//Already load
+	auto IT = _TextureHandles.find(Filename);
+	if (IT != _TextureHandles.end())
+	{
+		//Evict, load it again now
+		TextureRecord* Texture = _Textures.Get(IT->second);
+		if (Texture->bEvicted && _PendingTextures.find(IT->second) == _PendingTextures.end())
+		{
+			SDL_Surface* Surface = LoadSurface(Filename);
+			if (Surface && CreateTextureData(Surface, &Texture->Data, &Texture->AtlasPage))
+			{
+				Texture->bEvicted = false;
+				Texture->LastUseFrame = _FrameIndex;
+			}
+			if (Surface) SDL_FreeSurface(Surface);
+		}
+		return IT->second;
+	}
 
 	//Load the texture
-	if (_TextureMap.find(TextureId) == _TextureMap.end())
+	SDL_Surface* Surface = LoadSurface(Filename);
+	if (!Surface)
 	{
-		std::string FilePath = "./Assets/Texture/";
-		FilePath += Filename;
-		SDL_Texture* Texture = IMG_LoadTexture(_Renderer, FilePath.c_str());
-		if (Texture)
+		Engine::GetLogger()->LogMessage("Texture not found");
+		return 0;
+	}
+
+	TextureRecord Record;
+	Record.Name = Filename;
+	Record.LastUseFrame = _FrameIndex;
+	bool bCreated = CreateTextureData(Surface, &Record.Data, &Record.AtlasPage);
+	SDL_FreeSurface(Surface);
+	if (!bCreated) return 0;
+
+	size_t TextureId = _Textures.Add(Record);
+	_TextureHandles[Filename] = TextureId;
+
+	return TextureId;
+}
+
+//Own the surface load by a worker, free it if the completion is never call
+struct SurfaceLoad
+{
+public:
+	SDL_Surface* Surface = nullptr;
+
+	~SurfaceLoad()
+	{
+		if (Surface) SDL_FreeSurface(Surface);
+	}
+};
+
+size_t SDLGraphics::LoadTextureAsync(const std::string& Filename, const std::function<void(size_t)>& OnLoaded)
+{
+	//Already load or in loading
+	auto IT = _TextureHandles.find(Filename);
+	if (IT != _TextureHandles.end())
+	{
+		const TextureRecord* Texture = _Textures.Get(IT->second);
+		if (Texture->bEvicted) ReloadTexture(IT->second);
+
+		auto Pending = _PendingTextures.find(IT->second);
+		if (Pending != _PendingTextures.end())
 		{
-			_TextureMap[TextureId] = Texture;
+			if (OnLoaded) Pending->second.push_back(OnLoaded);
 		}
-		else
+		else if (OnLoaded)
 		{
-			Engine::GetLogger()->LogMessage("Texture not found");
+			OnLoaded(IT->second);
 		}
+		return IT->second;
 	}
 
+	//The handle is valid now, the texture is set when the worker finish
+	TextureRecord Record;
+	Record.Name = Filename;
+	Record.LastUseFrame = _FrameIndex;
+	size_t TextureId = _Textures.Add(Record);
+	_TextureHandles[Filename] = TextureId;
+	std::vector<std::function<void(size_t)>>& Callbacks = _PendingTextures[TextureId];
+	if (OnLoaded) Callbacks.push_back(OnLoaded);
+
+	//Read and decode on a worker, the upload is on the main thread
+	std::shared_ptr<SurfaceLoad> Load = std::make_shared<SurfaceLoad>();
+	Engine::GetJobSystem()->AddJob(
+		[Load, Filename]() { Load->Surface = LoadSurface(Filename); },
+		[this, Load, TextureId]() { FinishTextureLoad(TextureId, Load->Surface); });
+
 	return TextureId;
+}
+
+void SDLGraphics::ReloadTexture(size_t TextureId)
+{
+	//Already in loading
+	if (_PendingTextures.find(TextureId) != _PendingTextures.end()) return;
+	const TextureRecord* Texture = _Textures.Get(TextureId);
+	if (!Texture) return;
+
+	_PendingTextures[TextureId];
+
+	std::string Filename = Texture->Name;
+	std::shared_ptr<SurfaceLoad> Load = std::make_shared<SurfaceLoad>();
+	Engine::GetJobSystem()->AddJob(
+		[Load, Filename]() { Load->Surface = LoadSurface(Filename); },
+		[this, Load, TextureId]() { FinishTextureLoad(TextureId, Load->Surface); });
+}
+
+bool SDLGraphics::IsTextureLoaded(size_t TextureId) const
+{
+	return GetTextureData(TextureId) != nullptr;
+}
+
+SDL_Surface* SDLGraphics::LoadSurface(const std::string& Filename)
+{
+	std::string FilePath = "./Assets/Texture/";
+	FilePath += Filename;
+	SDL_Surface* Surface = IMG_Load(FilePath.c_str());
+	if (!Surface || Surface->format->format == SDL_PIXELFORMAT_RGBA32) return Surface;
+
+	//Convert now, the atlas copy need RGBA pixel
+	SDL_Surface* Converted = SDL_ConvertSurfaceFormat(Surface, SDL_PIXELFORMAT_RGBA32, 0);
+	SDL_FreeSurface(Surface);
+	return Converted;
+}
+
+bool SDLGraphics::CreateTextureData(SDL_Surface* Surface, TextureData* OutData, int* OutAtlasPage)
+{
+	//A evict texture can be in a other page or alone now
+	*OutData = TextureData();
+	*OutAtlasPage = -1;
+
+	//Small texture go in a atlas page, the big one have there own texture
+	if (!AddToAtlas(Surface, OutData, OutAtlasPage))
+	{
+		//The SDL error is by thread, copy it on the render thread
+		std::string Error;
+		RunOnRenderThread([&]()
+		{
+			OutData->Texture = SDL_CreateTextureFromSurface(_Renderer, Surface);
+			if (!OutData->Texture) Error = SDL_GetError();
+		});
+		OutData->Size = Vector2D<int>(Surface->w, Surface->h);
+		OutData->TextureSize = OutData->Size;
+
+		if (!OutData->Texture)
+		{
+			Engine::GetLogger()->LogMessage(Error.c_str());
+			return false;
+		}
+	}
+
+	if (!OutData->Texture)
+	{
+		return false;
+	}
+	return true;
+}
+
+void SDLGraphics::FinishTextureLoad(size_t TextureId, SDL_Surface* Surface)
+{
+	//Unload before the end of the load
+	auto Pending = _PendingTextures.find(TextureId);
+	TextureRecord* Record = _Textures.Get(TextureId);
+	if (Pending == _PendingTextures.end() || !Record) return;
+
+	std::vector<std::function<void(size_t)>> Callbacks = std::move(Pending->second);
+	_PendingTextures.erase(Pending);
+
+	if (!Surface)
+	{
+		Engine::GetLogger()->LogMessage("Texture not found");
+	}
+	if (!Surface || !CreateTextureData(Surface, &Record->Data, &Record->AtlasPage))
+	{
+		_TextureHandles.erase(Record->Name);
+		_Textures.Remove(TextureId);
+		TextureId = 0;
+	}
+	else
+	{
+		Record->bEvicted = false;
+	}
+
+	for (const std::function<void(size_t)>& Callback : Callbacks)
+	{
+		Callback(TextureId);
+	}
+}
+
+bool SDLGraphics::AddToAtlas(SDL_Surface* Surface, TextureData* OutData, int* OutAtlasPage)
+{
+	if (Surface->w > _AtlasMaxTextureSize || Surface->h > _AtlasMaxTextureSize) return false;
+
+	//Find a page with place, the padding is keep at the right and bottom
+	Vector2D<int> PackSize = Vector2D<int>(Surface->w + _AtlasPadding, Surface->h + _AtlasPadding);
+	Rectangle2D<int> PackRect = Rectangle2D<int>(Vector2D<int>(0, 0), Vector2D<int>(0, 0));
+	AtlasPage* Page = nullptr;
+	int PageIndex = -1;
+	for (size_t i = 0; i < _AtlasPages.size(); i++)
+	{
+		//A free page have no texture, it is reuse as a new page
+		if (_AtlasPages[i].Texture && _AtlasPages[i].Packer.Insert(PackSize, &PackRect))
+		{
+			Page = &_AtlasPages[i];
+			PageIndex = static_cast<int>(i);
+			break;
+		}
+	}
+
+	//Create a new page
+	if (!Page)
+	{
+		SDL_Texture* PageTexture = nullptr;
+		std::string Error;
+		RunOnRenderThread([&]()
+		{
+			PageTexture = SDL_CreateTexture(_Renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, _AtlasPageSize, _AtlasPageSize);
+			if (!PageTexture)
+			{
+				Error = SDL_GetError();
+				return;
+			}
+			SDL_SetTextureBlendMode(PageTexture, SDL_BLENDMODE_BLEND);
+
+			//Start with a transparent page
+			std::vector<Uint32> ClearPixels(static_cast<size_t>(_AtlasPageSize) * _AtlasPageSize, 0);
+			SDL_UpdateTexture(PageTexture, nullptr, ClearPixels.data(), _AtlasPageSize * sizeof(Uint32));
+		});
+		if (!PageTexture)
+		{
+			Engine::GetLogger()->LogMessage(Error.c_str());
+			return false;
+		}
+
+		for (size_t i = 0; i < _AtlasPages.size(); i++)
+		{
+			if (!_AtlasPages[i].Texture)
+			{
+				PageIndex = static_cast<int>(i);
+				break;
+			}
+		}
+		if (PageIndex == -1)
+		{
+			_AtlasPages.emplace_back(PageTexture, Vector2D<int>(_AtlasPageSize, _AtlasPageSize));
+			PageIndex = static_cast<int>(_AtlasPages.size()) - 1;
+		}
+		Page = &_AtlasPages[PageIndex];
+		Page->Texture = PageTexture;
+		if (!Page->Packer.Insert(PackSize, &PackRect)) return false;
+	}
+
+	//Copy the pixel in the page, the surface load by a worker is already convert
+	SDL_Surface* Converted = Surface->format->format == SDL_PIXELFORMAT_RGBA32 ? Surface : SDL_ConvertSurfaceFormat(Surface, SDL_PIXELFORMAT_RGBA32, 0);
+	if (!Converted)
+	{
+		Engine::GetLogger()->LogMessage(SDL_GetError());
+		return false;
+	}
+	SDL_Rect SDLRect = { PackRect.Position.X, PackRect.Position.Y, Surface->w, Surface->h };
+	RunOnRenderThread([&]() { SDL_UpdateTexture(Page->Texture, &SDLRect, Converted->pixels, Converted->pitch); });
+	if (Converted != Surface)
+	{
+		SDL_FreeSurface(Converted);
+	}
+
+	OutData->Texture = Page->Texture;
+	OutData->Size = Vector2D<int>(Surface->w, Surface->h);
+	OutData->Offset = PackRect.Position;
+	OutData->TextureSize = Page->Packer.GetSize();
+	OutData->bInAtlas = true;
+	Page->TextureCount++;
+	*OutAtlasPage = PageIndex;
+	return true;
 }
\ No newline at end of file
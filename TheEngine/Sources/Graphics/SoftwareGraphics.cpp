@@ -0,0 +1,930 @@
+#include "Graphics/SoftwareGraphics.h"
+
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+#include "Engine.h"
+#include "Logger/ILogger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SOFTWARE_GRAPHICS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+using namespace NPEngine;
+
+static_assert(sizeof(RGBA) == 4, "RGBA is copy as one pixel");
+
+//Blend ------------------------------------------------------------------------------
+
+//Divide by 255 with rounding, exact for all product of two byte
+static inline uint32_t Div255(uint32_t Value)
+{
+	Value += 128;
+	return (Value + (Value >> 8)) >> 8;
+}
+
+//Blend one source pixel modulate by the color on the destination, like the SDL blend mode
+static inline void BlendPixel(uint8_t* Dest, const uint8_t* Source, const RGBA& Color)
+{
+	uint32_t Alpha = Div255(Source[3] * Color.A);
+	if (Alpha == 0) return;
+	uint32_t Inverse = 255 - Alpha;
+
+	Dest[0] = static_cast<uint8_t>(Div255(Div255(Source[0] * Color.R) * Alpha + Dest[0] * Inverse));
+	Dest[1] = static_cast<uint8_t>(Div255(Div255(Source[1] * Color.G) * Alpha + Dest[1] * Inverse));
+	Dest[2] = static_cast<uint8_t>(Div255(Div255(Source[2] * Color.B) * Alpha + Dest[2] * Inverse));
+	Dest[3] = static_cast<uint8_t>(Div255(255 * Alpha + Dest[3] * Inverse));
+}
+
+#if SOFTWARE_GRAPHICS_SSE2
+//Divide the 16 bit lane by 255 with rounding
+static inline __m128i Div255Epi16(__m128i Value)
+{
+	Value = _mm_add_epi16(Value, _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(Value, _mm_srli_epi16(Value, 8)), 8);
+}
+
+//Blend two pixel in 16 bit lane, same math as BlendPixel
+static inline __m128i BlendTwoPixel(__m128i Source, __m128i Dest, __m128i Color, __m128i ColorMask, __m128i AlphaOne)
+{
+	Source = Div255Epi16(_mm_mullo_epi16(Source, Color));
+
+	//Alpha of each pixel in all is lane
+	__m128i Alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(Source, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+	__m128i Inverse = _mm_sub_epi16(_mm_set1_epi16(255), Alpha);
+
+	//The result alpha is Alpha + Dest * Inverse, use 255 as source alpha
+	Source = _mm_or_si128(_mm_and_si128(Source, ColorMask), AlphaOne);
+	return Div255Epi16(_mm_add_epi16(_mm_mullo_epi16(Source, Alpha), _mm_mullo_epi16(Dest, Inverse)));
+}
+#endif
+
+//Blend a row of source pixel on the destination, four pixel at a time with SSE2
+static void BlendRow(uint32_t* Dest, const uint32_t* Source, int Count, const RGBA& Color)
+{
+	int i = 0;
+
+#if SOFTWARE_GRAPHICS_SSE2
+	const __m128i Zero = _mm_setzero_si128();
+	const __m128i ColorLane = _mm_setr_epi16(Color.R, Color.G, Color.B, Color.A, Color.R, Color.G, Color.B, Color.A);
+	const __m128i ColorMask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+	const __m128i AlphaOne = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+	const __m128i AlphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+	for (; i + 4 <= Count; i += 4)
+	{
+		__m128i SourcePixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i));
+
+		//Skip the four pixel if all are transparent
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(SourcePixels, AlphaMask), Zero)) == 0xFFFF) continue;
+
+		__m128i DestPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Dest + i));
+
+		__m128i Low = BlendTwoPixel(_mm_unpacklo_epi8(SourcePixels, Zero), _mm_unpacklo_epi8(DestPixels, Zero), ColorLane, ColorMask, AlphaOne);
+		__m128i High = BlendTwoPixel(_mm_unpackhi_epi8(SourcePixels, Zero), _mm_unpackhi_epi8(DestPixels, Zero), ColorLane, ColorMask, AlphaOne);
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + i), _mm_packus_epi16(Low, High));
+	}
+#endif
+
+	for (; i < Count; i++)
+	{
+		BlendPixel(reinterpret_cast<uint8_t*>(Dest + i), reinterpret_cast<const uint8_t*>(Source + i), Color);
+	}
+}
+
+//Return the color as one pixel
+static inline uint32_t PackColor(const RGBA& Color)
+{
+	uint32_t Pixel = 0;
+	std::memcpy(&Pixel, &Color, sizeof(Pixel));
+	return Pixel;
+}
+
+//-----------------------------------------------------------------------------------
+
+bool SoftwareGraphics::Initialize(const Param& Params)
+{
+	//No window, no sound card, use the dummy audio if the environment dont ask another one
+	SDL_SetHintWithPriority(SDL_HINT_AUDIODRIVER, "dummy", SDL_HINT_DEFAULT);
+
+	if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) != 0)
+	{
+		Engine::GetLogger()->LogMessage(SDL_GetError());
+		return false;
+	}
+
+	auto IT = Params.find("Width");
+	_ScreenSize.X = IT != Params.end() ? std::any_cast<int>(IT->second) : 800;
+	IT = Params.find("Height");
+	_ScreenSize.Y = IT != Params.end() ? std::any_cast<int>(IT->second) : 600;
+	IT = Params.find("CaptureInterval");
+	_CaptureInterval = IT != Params.end() ? std::any_cast<int>(IT->second) : 0;
+	IT = Params.find("CapturePath");
+	_CapturePath = IT != Params.end() ? std::any_cast<std::string>(IT->second) : std::string("./Capture");
+
+	_FrameBuffer.assign(static_cast<size_t>(_ScreenSize.X) * _ScreenSize.Y, 0);
+	SetTarget(_FrameBuffer.data(), _ScreenSize);
+
+	if (TTF_Init() == -1)
+	{
+		Engine::GetLogger()->LogMessage(TTF_GetError());
+		return false;
+	}
+
+	return true;
+}
+
+void SoftwareGraphics::Shutdown(const Param& Params)
+{
+	_Textures.Clear();
+	_TextureHandles.clear();
+	_PendingTextures.clear();
+
+	_Fonts.ForEach([](SoftwareFont& Font)
+	{
+		TTF_CloseFont(Font.Font);
+		Font.Font = nullptr;
+	});
+	_Fonts.Clear();
+	_FontHandles.clear();
+
+	_FrameBuffer.clear();
+	_TargetPixels = nullptr;
+
+	TTF_Quit();
+	SDL_Quit();
+}
+
+void SoftwareGraphics::SetBackgroundColor(const Color& Color)
+{
+	_BackgroundColor = Color;
+}
+
+void SoftwareGraphics::SetColor(const Color& Color)
+{
+}
+
+void SoftwareGraphics::Clear()
+{
+	//The frame start opaque like the window
+	RGBA Background = _BackgroundColor.rgba;
+	Background.A = 255;
+	std::fill(_FrameBuffer.begin(), _FrameBuffer.end(), PackColor(Background));
+}
+
+void SoftwareGraphics::Present()
+{
+	Uint64 PresentStart = SDL_GetPerformanceCounter();
+
+	_FrameCount++;
+
+	if (_CaptureInterval > 0 && _FrameCount % _CaptureInterval == 0)
+	{
+		SavePNG(_CapturePath + std::to_string(_FrameCount) + ".png");
+	}
+
+	EvictTextures();
+
+	_CurrentStats.PresentTime = static_cast<double>(SDL_GetPerformanceCounter() - PresentStart) * 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+	PublishFrameStats(_CurrentStats);
+	_CurrentStats = FrameStats();
+	_BoundTexture = nullptr;
+}
+
+bool SoftwareGraphics::SavePNG(const std::string& FilePath) const
+{
+	if (_FrameBuffer.empty()) return false;
+
+	SDL_Surface* Surface = SDL_CreateRGBSurfaceWithFormatFrom(const_cast<uint32_t*>(_FrameBuffer.data()),
+		_ScreenSize.X, _ScreenSize.Y, 32, _ScreenSize.X * 4, SDL_PIXELFORMAT_RGBA32);
+	if (!Surface)
+	{
+		Engine::GetLogger()->LogMessage(SDL_GetError());
+		return false;
+	}
+
+	bool bSaved = IMG_SavePNG(Surface, FilePath.c_str()) == 0;
+	if (!bSaved)
+	{
+		Engine::GetLogger()->LogMessage(IMG_GetError());
+	}
+	SDL_FreeSurface(Surface);
+
+	return bSaved;
+}
+
+//Primitive -------------------------------------------------------------------------
+
+void SoftwareGraphics::DrawRect(const Rectangle2D<float>& Rect, const Color& Color, bool bFill)
+{
+	Rectangle2D<float> ScreenRect = WorldToScreen(Rect);
+	int X0 = static_cast<int>(std::floor(ScreenRect.Position.X + 0.5f));
+	int Y0 = static_cast<int>(std::floor(ScreenRect.Position.Y + 0.5f));
+	int X1 = static_cast<int>(std::floor(ScreenRect.Position.X + ScreenRect.Size.X + 0.5f));
+	int Y1 = static_cast<int>(std::floor(ScreenRect.Position.Y + ScreenRect.Size.Y + 0.5f));
+
+	_CurrentStats.DrawCalls++;
+
+	if (bFill)
+	{
+		FillRect(X0, Y0, X1, Y1, Color.rgba);
+		return;
+	}
+
+	//Each side once, the corner are not blend two time
+	FillRect(X0, Y0, X1, Y0 + 1, Color.rgba);
+	FillRect(X0, Y1 - 1, X1, Y1, Color.rgba);
+	FillRect(X0, Y0 + 1, X0 + 1, Y1 - 1, Color.rgba);
+	FillRect(X1 - 1, Y0 + 1, X1, Y1 - 1, Color.rgba);
+}
+
+void SoftwareGraphics::DrawLine(const Vector2D<float>& Start, const Vector2D<float>& End, const Color& Color)
+{
+	_CurrentStats.DrawCalls++;
+	DrawScreenLine(WorldToScreen(Start), WorldToScreen(End), Color.rgba);
+}
+
+void SoftwareGraphics::DrawPoint(const Vector2D<float>& Position, const Color& Color)
+{
+	Vector2D<float> ScreenPosition = WorldToScreen(Position);
+	int X = static_cast<int>(std::floor(ScreenPosition.X));
+	int Y = static_cast<int>(std::floor(ScreenPosition.Y));
+	_CurrentStats.DrawCalls++;
+	FillRect(X, Y, X + 1, Y + 1, Color.rgba);
+}
+
+void SoftwareGraphics::DrawCircle(const Vector2D<float>& Position, const float Ray, const Color& Color)
+{
+	const std::array<Vector2D<float>, DebugCircleSegments + 1>& UnitCircle = DebugDraw::GetUnitCircle();
+
+	Vector2D<float> Center = WorldToScreen(Position);
+	float ScreenRay = UseCamera() ? Ray * _Camera.Zoom : Ray;
+	_CurrentStats.DrawCalls++;
+	for (int i = 0; i < DebugCircleSegments; i++)
+	{
+		Vector2D<float> Start = Vector2D<float>(Center.X + UnitCircle[i].X * ScreenRay, Center.Y + UnitCircle[i].Y * ScreenRay);
+		Vector2D<float> End = Vector2D<float>(Center.X + UnitCircle[i + 1].X * ScreenRay, Center.Y + UnitCircle[i + 1].Y * ScreenRay);
+		DrawScreenLine(Start, End, Color.rgba);
+	}
+}
+
+void SoftwareGraphics::DrawLines(const DebugLine* Lines, size_t Count)
+{
+	//All the line are one draw
+	if (Count == 0) return;
+	_CurrentStats.DrawCalls++;
+
+	for (size_t i = 0; i < Count; i++)
+	{
+		DrawScreenLine(WorldToScreen(Lines[i].Start), WorldToScreen(Lines[i].End), Lines[i].Color);
+	}
+}
+
+void SoftwareGraphics::FillRect(int X0, int Y0, int X1, int Y1, const RGBA& Color)
+{
+	X0 = std::max(X0, _ClipRect.Position.X);
+	Y0 = std::max(Y0, _ClipRect.Position.Y);
+	X1 = std::min(X1, _ClipRect.Position.X + _ClipRect.Size.X);
+	Y1 = std::min(Y1, _ClipRect.Position.Y + _ClipRect.Size.Y);
+	if (X0 >= X1 || Y0 >= Y1 || Color.A == 0) return;
+
+	//The color is the source, blend with white for no change
+	_RowBuffer.assign(X1 - X0, PackColor(Color));
+	const RGBA White = RGBA();
+	for (int Y = Y0; Y < Y1; Y++)
+	{
+		BlendRow(_TargetPixels + static_cast<size_t>(Y) * _TargetSize.X + X0, _RowBuffer.data(), X1 - X0, White);
+	}
+}
+
+void SoftwareGraphics::DrawScreenLine(const Vector2D<float>& Start, const Vector2D<float>& End, const RGBA& Color)
+{
+	if (Color.A == 0) return;
+
+	float DeltaX = End.X - Start.X;
+	float DeltaY = End.Y - Start.Y;
+	int Steps = static_cast<int>(std::ceil(std::max(std::fabs(DeltaX), std::fabs(DeltaY))));
+	float StepX = Steps > 0 ? DeltaX / Steps : 0.0f;
+	float StepY = Steps > 0 ? DeltaY / Steps : 0.0f;
+
+	uint32_t Pixel = PackColor(Color);
+	const RGBA White = RGBA();
+	int ClipRight = _ClipRect.Position.X + _ClipRect.Size.X;
+	int ClipBottom = _ClipRect.Position.Y + _ClipRect.Size.Y;
+
+	for (int i = 0; i <= Steps; i++)
+	{
+		int X = static_cast<int>(std::floor(Start.X + StepX * i));
+		int Y = static_cast<int>(std::floor(Start.Y + StepY * i));
+		if (X < _ClipRect.Position.X || Y < _ClipRect.Position.Y || X >= ClipRight || Y >= ClipBottom) continue;
+
+		BlendPixel(reinterpret_cast<uint8_t*>(_TargetPixels + static_cast<size_t>(Y) * _TargetSize.X + X), reinterpret_cast<const uint8_t*>(&Pixel), White);
+	}
+}
+
+//Texture ---------------------------------------------------------------------------
+
+size_t SoftwareGraphics::LoadTexture(const std::string& Filename)
+{
+	//Already load
+	auto IT = _TextureHandles.find(Filename);
+	if (IT != _TextureHandles.end())
+	{
+		SoftwareTexture* Texture = _Textures.Get(IT->second);
+		if (Texture->bEvicted) ReloadTexture(*Texture);
+		return IT->second;
+	}
+
+	SoftwareTexture Texture;
+	Texture.Name = Filename;
+	Texture.LastUseFrame = _FrameCount;
+	if (!LoadPixels(Filename, &Texture))
+	{
+		Engine::GetLogger()->LogMessage("Texture not found");
+		return 0;
+	}
+
+	size_t TextureId = _Textures.Add(Texture);
+	_TextureHandles[Filename] = TextureId;
+
+	return TextureId;
+}
+
+size_t SoftwareGraphics::LoadTextureAsync(const std::string& Filename, const std::function<void(size_t)>& OnLoaded)
+{
+	//Already load or in loading
+	auto IT = _TextureHandles.find(Filename);
+	if (IT != _TextureHandles.end())
+	{
+		SoftwareTexture* Texture = _Textures.Get(IT->second);
+		if (Texture->bEvicted) ReloadTexture(*Texture);
+
+		auto Pending = _PendingTextures.find(IT->second);
+		if (Pending != _PendingTextures.end())
+		{
+			if (OnLoaded) Pending->second.push_back(OnLoaded);
+		}
+		else if (OnLoaded)
+		{
+			OnLoaded(IT->second);
+		}
+		return IT->second;
+	}
+
+	SoftwareTexture Texture;
+	Texture.Name = Filename;
+	Texture.bLoaded = false;
+	Texture.LastUseFrame = _FrameCount;
+	size_t TextureId = _Textures.Add(Texture);
+	_TextureHandles[Filename] = TextureId;
+	std::vector<std::function<void(size_t)>>& Callbacks = _PendingTextures[TextureId];
+	if (OnLoaded) Callbacks.push_back(OnLoaded);
+
+	//Decode on a worker, the pixel are move in the table on the main thread
+	std::shared_ptr<SoftwareTexture> Load = std::make_shared<SoftwareTexture>();
+	std::shared_ptr<bool> bLoaded = std::make_shared<bool>(false);
+	Engine::GetJobSystem()->AddJob(
+		[Load, bLoaded, Filename]() { *bLoaded = LoadPixels(Filename, Load.get()); },
+		[this, Load, bLoaded, TextureId]()
+		{
+			auto Pending = _PendingTextures.find(TextureId);
+			SoftwareTexture* Texture = _Textures.Get(TextureId);
+			if (Pending == _PendingTextures.end() || !Texture) return;
+
+			std::vector<std::function<void(size_t)>> Callbacks = std::move(Pending->second);
+			_PendingTextures.erase(Pending);
+
+			size_t LoadedId = TextureId;
+			if (!*bLoaded)
+			{
+				Engine::GetLogger()->LogMessage("Texture not found");
+				_TextureHandles.erase(Texture->Name);
+				_Textures.Remove(TextureId);
+				LoadedId = 0;
+			}
+			else
+			{
+				Texture->Size = Load->Size;
+				Texture->Pixels = std::move(Load->Pixels);
+				Texture->bLoaded = true;
+			}
+
+			for (const std::function<void(size_t)>& Callback : Callbacks)
+			{
+				Callback(LoadedId);
+			}
+		});
+
+	return TextureId;
+}
+
+bool SoftwareGraphics::IsTextureLoaded(size_t TextureId) const
+{
+	return GetLoadedTexture(TextureId) != nullptr;
+}
+
+const SoftwareTexture* SoftwareGraphics::GetLoadedTexture(size_t TextureId) const
+{
+	const SoftwareTexture* Texture = _Textures.Get(TextureId);
+	if (!Texture || !Texture->bLoaded) return nullptr;
+	return Texture;
+}
+
+const SoftwareTexture* SoftwareGraphics::UseTexture(size_t TextureId)
+{
+	SoftwareTexture* Texture = _Textures.Get(TextureId);
+	if (!Texture) return nullptr;
+
+	Texture->LastUseFrame = _FrameCount;
+	if (Texture->bEvicted && !ReloadTexture(*Texture)) return nullptr;
+
+	if (!Texture->bLoaded) return nullptr;
+	return Texture;
+}
+
+bool SoftwareGraphics::ReloadTexture(SoftwareTexture& Texture)
+{
+	if (!LoadPixels(Texture.Name, &Texture))
+	{
+		Engine::GetLogger()->LogMessage("Texture not found");
+		return false;
+	}
+
+	Texture.bLoaded = true;
+	Texture.bEvicted = false;
+	return true;
+}
+
+void SoftwareGraphics::EvictTextures()
+{
+	if (_TextureBudget == 0) return;
+
+	size_t ResidentBytes = 0;
+	std::vector<std::pair<size_t, size_t>> Candidates;
+	_Textures.ForEachHandle([&](size_t TextureId, const SoftwareTexture& Texture)
+	{
+		ResidentBytes += Texture.Pixels.size() * sizeof(uint32_t);
+
+		//Only a texture with a file can be load again, the one draw in the frame present stay
+		if (!Texture.bLoaded || Texture.Name.empty() || Texture.RefCount > 0 || Texture.LastUseFrame + 1 >= _FrameCount) return;
+		Candidates.emplace_back(Texture.LastUseFrame, TextureId);
+	});
+	if (ResidentBytes <= _TextureBudget) return;
+
+	//Oldest use first
+	std::sort(Candidates.begin(), Candidates.end());
+	for (const std::pair<size_t, size_t>& Candidate : Candidates)
+	{
+		if (ResidentBytes <= _TextureBudget) break;
+
+		SoftwareTexture* Texture = _Textures.Get(Candidate.second);
+		ResidentBytes -= Texture->Pixels.size() * sizeof(uint32_t);
+
+		//The size stay for GetTextureSize
+		std::vector<uint32_t>().swap(Texture->Pixels);
+		Texture->bLoaded = false;
+		Texture->bEvicted = true;
+	}
+}
+
+bool SoftwareGraphics::LoadPixels(const std::string& Filename, SoftwareTexture* OutTexture)
+{
+	std::string FilePath = "./Assets/Texture/";
+	FilePath += Filename;
+	SDL_Surface* Surface = IMG_Load(FilePath.c_str());
+	if (!Surface) return false;
+
+	SDL_Surface* Converted = SDL_ConvertSurfaceFormat(Surface, SDL_PIXELFORMAT_RGBA32, 0);
+	SDL_FreeSurface(Surface);
+	if (!Converted) return false;
+
+	//Copy row by row, the surface pitch can have padding
+	OutTexture->Size = Vector2D<int>(Converted->w, Converted->h);
+	OutTexture->Pixels.resize(static_cast<size_t>(Converted->w) * Converted->h);
+	for (int Y = 0; Y < Converted->h; Y++)
+	{
+		const uint8_t* Row = static_cast<const uint8_t*>(Converted->pixels) + static_cast<size_t>(Y) * Converted->pitch;
+		std::memcpy(OutTexture->Pixels.data() + static_cast<size_t>(Y) * Converted->w, Row, static_cast<size_t>(Converted->w) * 4);
+	}
+	SDL_FreeSurface(Converted);
+
+	return true;
+}
+
+void SoftwareGraphics::DrawTexture(size_t TextureId, const Rectangle2D<float>& DrawRect, const Color& Color, float Angle, const Flip& Flip)
+{
+	const SoftwareTexture* Texture = UseTexture(TextureId);
+	if (!Texture) return;
+
+	Rectangle2D<int> SourceRect = Rectangle2D<int>(Vector2D<int>(0, 0), Texture->Size);
+	BlitTexture(*Texture, SourceRect, WorldToScreen(DrawRect), Color.rgba, Angle, Flip);
+}
+
+void SoftwareGraphics::DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const Vector2D<int>& CellPosition, const Color& Color, float Angle, const Flip& Flip)
+{
+	const SoftwareTexture* Texture = UseTexture(TextureId);
+	if (!Texture) return;
+
+	Rectangle2D<int> SourceRect = Rectangle2D<int>(Vector2D<int>(CellSize.X * CellPosition.X, CellSize.Y * CellPosition.Y), CellSize);
+	BlitTexture(*Texture, SourceRect, WorldToScreen(DrawRect), Color.rgba, Angle, Flip);
+}
+
+void SoftwareGraphics::DrawTextureTile(size_t TextureId, const Rectangle2D<float>& DrawRect, const Vector2D<int>& CellSize, const int& CellIndex, const Color& Color, float Angle, const Flip& Flip)
+{
+	//Empty cell
+	if (CellIndex < 0) return;
+
+	const SoftwareTexture* Texture = UseTexture(TextureId);
+	if (!Texture || CellSize.X <= 0) return;
+
+	int CellsPerRow = Texture->Size.X / CellSize.X;
+	if (CellsPerRow <= 0) return;
+
+	Vector2D<int> CellPosition = Vector2D<int>((CellIndex % CellsPerRow) * CellSize.X, (CellIndex / CellsPerRow) * CellSize.Y);
+	BlitTexture(*Texture, Rectangle2D<int>(CellPosition, CellSize), WorldToScreen(DrawRect), Color.rgba, Angle, Flip);
+}
+
+void SoftwareGraphics::BlitTexture(const SoftwareTexture& Texture, const Rectangle2D<int>& SourceRect, const Rectangle2D<float>& ScreenRect, const RGBA& Color, float Angle, const Flip& Flip)
+{
+	_CurrentStats.DrawCalls++;
+	_CurrentStats.QuadsSubmitted++;
+	if (&Texture != _BoundTexture)
+	{
+		_CurrentStats.TextureBinds++;
+		_BoundTexture = &Texture;
+	}
+
+	//Keep the source in the texture
+	int SourceX = std::max(SourceRect.Position.X, 0);
+	int SourceY = std::max(SourceRect.Position.Y, 0);
+	int SourceWidth = std::min(SourceRect.Position.X + SourceRect.Size.X, Texture.Size.X) - SourceX;
+	int SourceHeight = std::min(SourceRect.Position.Y + SourceRect.Size.Y, Texture.Size.Y) - SourceY;
+	if (SourceWidth <= 0 || SourceHeight <= 0 || ScreenRect.Size.X <= 0.0f || ScreenRect.Size.Y <= 0.0f || Color.A == 0) return;
+
+	float ScaleX = SourceWidth / ScreenRect.Size.X;
+	float ScaleY = SourceHeight / ScreenRect.Size.Y;
+	Vector2D<float> HalfSize = Vector2D<float>(ScreenRect.Size.X * 0.5f, ScreenRect.Size.Y * 0.5f);
+	Vector2D<float> Center = Vector2D<float>(ScreenRect.Position.X + HalfSize.X, ScreenRect.Position.Y + HalfSize.Y);
+
+	//Pixel cover by the rect, the rotate rect use is bounds
+	Rectangle2D<float> Bounds = ScreenRect;
+	float Cos = 1.0f;
+	float Sin = 0.0f;
+	if (Angle != 0.0f)
+	{
+		float Radian = Angle * static_cast<float>(M_PI) / 180.0f;
+		Cos = std::cos(Radian);
+		Sin = std::sin(Radian);
+		float ExtentX = std::fabs(HalfSize.X * Cos) + std::fabs(HalfSize.Y * Sin);
+		float ExtentY = std::fabs(HalfSize.X * Sin) + std::fabs(HalfSize.Y * Cos);
+		Bounds = Rectangle2D<float>(Vector2D<float>(Center.X - ExtentX, Center.Y - ExtentY), Vector2D<float>(ExtentX * 2.0f, ExtentY * 2.0f));
+	}
+
+	int X0 = std::max(static_cast<int>(std::floor(Bounds.Position.X + 0.5f)), _ClipRect.Position.X);
+	int Y0 = std::max(static_cast<int>(std::floor(Bounds.Position.Y + 0.5f)), _ClipRect.Position.Y);
+	int X1 = std::min(static_cast<int>(std::floor(Bounds.Position.X + Bounds.Size.X + 0.5f)), _ClipRect.Position.X + _ClipRect.Size.X);
+	int Y1 = std::min(static_cast<int>(std::floor(Bounds.Position.Y + Bounds.Size.Y + 0.5f)), _ClipRect.Position.Y + _ClipRect.Size.Y);
+	if (X0 >= X1 || Y0 >= Y1) return;
+
+	int Count = X1 - X0;
+	_RowBuffer.resize(Count);
+
+	//Axis aligned, the source column is the same for all row
+	if (Angle == 0.0f)
+	{
+		_ColumnBuffer.resize(Count);
+		for (int i = 0; i < Count; i++)
+		{
+			int U = std::min(std::max(static_cast<int>((X0 + i + 0.5f - ScreenRect.Position.X) * ScaleX), 0), SourceWidth - 1);
+			_ColumnBuffer[i] = SourceX + (Flip.Horizontal ? SourceWidth - 1 - U : U);
+		}
+		bool bContiguous = _ColumnBuffer[Count - 1] - _ColumnBuffer[0] == Count - 1;
+
+		for (int Y = Y0; Y < Y1; Y++)
+		{
+			int V = std::min(std::max(static_cast<int>((Y + 0.5f - ScreenRect.Position.Y) * ScaleY), 0), SourceHeight - 1);
+			V = SourceY + (Flip.Vertical ? SourceHeight - 1 - V : V);
+			const uint32_t* SourceRow = Texture.Pixels.data() + static_cast<size_t>(V) * Texture.Size.X;
+			uint32_t* DestRow = _TargetPixels + static_cast<size_t>(Y) * _TargetSize.X + X0;
+
+			//Same size, the source row is blend without copy
+			if (bContiguous)
+			{
+				BlendRow(DestRow, SourceRow + _ColumnBuffer[0], Count, Color);
+				continue;
+			}
+
+			for (int i = 0; i < Count; i++)
+			{
+				_RowBuffer[i] = SourceRow[_ColumnBuffer[i]];
+			}
+			BlendRow(DestRow, _RowBuffer.data(), Count, Color);
+		}
+		return;
+	}
+
+	//Rotate, each pixel go back in the rect space, the pixel outside are transparent
+	for (int Y = Y0; Y < Y1; Y++)
+	{
+		float DeltaY = Y + 0.5f - Center.Y;
+		for (int i = 0; i < Count; i++)
+		{
+			float DeltaX = X0 + i + 0.5f - Center.X;
+			float LocalX = DeltaX * Cos + DeltaY * Sin + HalfSize.X;
+			float LocalY = -DeltaX * Sin + DeltaY * Cos + HalfSize.Y;
+			if (LocalX < 0.0f || LocalY < 0.0f || LocalX >= ScreenRect.Size.X || LocalY >= ScreenRect.Size.Y)
+			{
+				_RowBuffer[i] = 0;
+				continue;
+			}
+
+			int U = std::min(static_cast<int>(LocalX * ScaleX), SourceWidth - 1);
+			int V = std::min(static_cast<int>(LocalY * ScaleY), SourceHeight - 1);
+			U = SourceX + (Flip.Horizontal ? SourceWidth - 1 - U : U);
+			V = SourceY + (Flip.Vertical ? SourceHeight - 1 - V : V);
+			_RowBuffer[i] = Texture.Pixels[static_cast<size_t>(V) * Texture.Size.X + U];
+		}
+		BlendRow(_TargetPixels + static_cast<size_t>(Y) * _TargetSize.X + X0, _RowBuffer.data(), Count, Color);
+	}
+}
+
+void SoftwareGraphics::GetTextureSize(size_t TextureId, Vector2D<int>* Size)
+{
+	//A evict texture keep is size
+	const SoftwareTexture* Texture = _Textures.Get(TextureId);
+	if (!Texture || (!Texture->bLoaded && !Texture->bEvicted)) return;
+
+	*Size = Texture->Size;
+}
+
+void SoftwareGraphics::UnloadTexture(size_t TextureId)
+{
+	SoftwareTexture* Texture = _Textures.Get(TextureId);
+	if (!Texture) return;
+
+	//A texture in loading is drop when the worker finish
+	_PendingTextures.erase(TextureId);
+
+	if (!Texture->Name.empty())
+	{
+		_TextureHandles.erase(Texture->Name);
+	}
+	_Textures.Remove(TextureId);
+}
+
+void SoftwareGraphics::AcquireTexture(size_t TextureId)
+{
+	SoftwareTexture* Texture = _Textures.Get(TextureId);
+	if (!Texture) return;
+
+	Texture->RefCount++;
+}
+
+void SoftwareGraphics::ReleaseTexture(size_t TextureId)
+{
+	SoftwareTexture* Texture = _Textures.Get(TextureId);
+	if (!Texture || Texture->RefCount <= 0) return;
+
+	//Stay load, evict only if the budget is pass
+	Texture->RefCount--;
+}
+
+void SoftwareGraphics::SetTextureBudget(size_t Bytes)
+{
+	_TextureBudget = Bytes;
+}
+
+std::vector<TextureResidency> SoftwareGraphics::GetTextureResidency() const
+{
+	std::vector<TextureResidency> Residency;
+	Residency.reserve(_Textures.Size());
+
+	_Textures.ForEachHandle([&Residency](size_t TextureId, const SoftwareTexture& Texture)
+	{
+		TextureResidency Entry;
+		Entry.TextureId = TextureId;
+		Entry.Name = Texture.Name;
+		Entry.Size = Texture.Size;
+		Entry.Bytes = static_cast<size_t>(Texture.Size.X) * Texture.Size.Y * sizeof(uint32_t);
+		Entry.RefCount = Texture.RefCount;
+		Entry.LastUseFrame = Texture.LastUseFrame;
+		Entry.bResident = !Texture.bEvicted;
+		Residency.push_back(Entry);
+	});
+
+	return Residency;
+}
+
+size_t SoftwareGraphics::CreateRenderTexture(const Vector2D<int>& Size)
+{
+	if (Size.X <= 0 || Size.Y <= 0) return 0;
+
+	SoftwareTexture Texture;
+	Texture.Size = Size;
+	Texture.Pixels.assign(static_cast<size_t>(Size.X) * Size.Y, 0);
+	return _Textures.Add(Texture);
+}
+
+bool SoftwareGraphics::BeginDrawToTexture(size_t TextureId)
+{
+	SoftwareTexture* Texture = _Textures.Get(TextureId);
+	if (!Texture || !Texture->bLoaded || Texture->Pixels.empty()) return false;
+
+	//The texture is clear with transparent
+	std::fill(Texture->Pixels.begin(), Texture->Pixels.end(), 0);
+
+	_bDrawToTexture = true;
+	SetTarget(Texture->Pixels.data(), Texture->Size);
+
+	return true;
+}
+
+void SoftwareGraphics::EndDrawToTexture()
+{
+	_bDrawToTexture = false;
+	SetTarget(_FrameBuffer.data(), _ScreenSize);
+}
+
+//Text ------------------------------------------------------------------------------
+
+size_t SoftwareGraphics::LoadFont(const std::string& Filename, int FontSize)
+{
+	std::string FontName = Filename + ":" + std::to_string(FontSize);
+	auto IT = _FontHandles.find(FontName);
+	if (IT != _FontHandles.end()) return IT->second;
+
+	std::string FilePath = "./Assets/Font/";
+	FilePath += Filename;
+
+	SoftwareFont Font;
+	Font.Font = TTF_OpenFont(FilePath.c_str(), FontSize);
+	if (!Font.Font)
+	{
+		Engine::GetLogger()->LogMessage(TTF_GetError());
+		return 0;
+	}
+
+	size_t FontId = _Fonts.Add(Font);
+	_FontHandles[FontName] = FontId;
+
+	return FontId;
+}
+
+void SoftwareGraphics::DrawString(size_t FontId, const char* Text, const Vector2D<int>& Location, const Color& Color)
+{
+	SoftwareFont* Font = _Fonts.Get(FontId);
+	if (!Font || !Font->Font || !Text || Text[0] == '\0') return;
+
+	//Render the text in white the first time, the color is apply in the blend
+	auto IT = Font->Texts.find(Text);
+	if (IT == Font->Texts.end())
+	{
+		if (Font->Texts.size() >= _MaxFontText)
+		{
+			Font->Texts.clear();
+		}
+
+		SDL_Surface* Surface = TTF_RenderText_Blended(Font->Font, Text, SDL_Color{ 255, 255, 255, 255 });
+		_CurrentStats.TextRasterizations++;
+		if (!Surface)
+		{
+			Engine::GetLogger()->LogMessage(TTF_GetError());
+			return;
+		}
+		SDL_Surface* Converted = SDL_ConvertSurfaceFormat(Surface, SDL_PIXELFORMAT_RGBA32, 0);
+		SDL_FreeSurface(Surface);
+		if (!Converted) return;
+
+		SoftwareTexture TextTexture;
+		TextTexture.Size = Vector2D<int>(Converted->w, Converted->h);
+		TextTexture.Pixels.resize(static_cast<size_t>(Converted->w) * Converted->h);
+		for (int Y = 0; Y < Converted->h; Y++)
+		{
+			const uint8_t* Row = static_cast<const uint8_t*>(Converted->pixels) + static_cast<size_t>(Y) * Converted->pitch;
+			std::memcpy(TextTexture.Pixels.data() + static_cast<size_t>(Y) * Converted->w, Row, static_cast<size_t>(Converted->w) * 4);
+		}
+		SDL_FreeSurface(Converted);
+
+		IT = Font->Texts.emplace(Text, std::move(TextTexture)).first;
+	}
+
+	const SoftwareTexture& TextTexture = IT->second;
+	Rectangle2D<float> DrawRect = Rectangle2D<float>(
+		Vector2D<float>(static_cast<float>(Location.X), static_cast<float>(Location.Y)),
+		Vector2D<float>(static_cast<float>(TextTexture.Size.X), static_cast<float>(TextTexture.Size.Y)));
+	BlitTexture(TextTexture, Rectangle2D<int>(Vector2D<int>(0, 0), TextTexture.Size), WorldToScreen(DrawRect), Color.rgba, 0.0f, Flip());
+}
+
+void SoftwareGraphics::GetTextSize(size_t FontId, const char* Text, Vector2D<int>* Size)
+{
+	SoftwareFont* Font = _Fonts.Get(FontId);
+	if (!Font || !Font->Font) return;
+
+	int Width = 0;
+	int Height = 0;
+	if (TTF_SizeText(Font->Font, Text, &Width, &Height) != 0) return;
+
+	Size->X = Width;
+	Size->Y = Height;
+}
+
+//Camera ----------------------------------------------------------------------------
+
+Vector2D<int> SoftwareGraphics::GetScreenSize() const
+{
+	return _ScreenSize;
+}
+
+bool SoftwareGraphics::CheckPointIsOutOfScreen(const Vector2D<float>& Point) const
+{
+	Rectangle2D<int> Viewport = GetViewport();
+	Vector2D<float> ScreenPoint = WorldToScreen(Point);
+
+	if (ScreenPoint.X < Viewport.Position.X || ScreenPoint.Y < Viewport.Position.Y
+		|| ScreenPoint.X > Viewport.Position.X + Viewport.Size.X || ScreenPoint.Y > Viewport.Position.Y + Viewport.Size.Y)
+	{
+		return true;
+	}
+	return false;
+}
+
+void SoftwareGraphics::SetCamera(const Camera& NewCamera)
+{
+	_Camera = NewCamera;
+	if (_Camera.Zoom <= 0.0f)
+	{
+		_Camera.Zoom = 1.0f;
+	}
+
+	UpdateClipRect();
+}
+
+Rectangle2D<float> SoftwareGraphics::GetViewRect() const
+{
+	Rectangle2D<int> Viewport = GetViewport();
+	Vector2D<float> Size = Vector2D<float>(Viewport.Size.X / _Camera.Zoom, Viewport.Size.Y / _Camera.Zoom);
+
+	return Rectangle2D<float>(_Camera.Position, Size);
+}
+
+void SoftwareGraphics::SetScreenSpace(bool bScreenSpace)
+{
+	_bScreenSpace = bScreenSpace;
+}
+
+Rectangle2D<int> SoftwareGraphics::GetViewport() const
+{
+	if (_Camera.Viewport.Size.X > 0 && _Camera.Viewport.Size.Y > 0)
+	{
+		return _Camera.Viewport;
+	}
+	return Rectangle2D<int>(Vector2D<int>(0, 0), _ScreenSize);
+}
+
+bool SoftwareGraphics::UseCamera() const
+{
+	return !_bScreenSpace && !_bDrawToTexture;
+}
+
+Vector2D<float> SoftwareGraphics::WorldToScreen(const Vector2D<float>& Position) const
+{
+	if (!UseCamera()) return Position;
+
+	Rectangle2D<int> Viewport = GetViewport();
+	return Vector2D<float>(
+		Viewport.Position.X + (Position.X - _Camera.Position.X) * _Camera.Zoom,
+		Viewport.Position.Y + (Position.Y - _Camera.Position.Y) * _Camera.Zoom);
+}
+
+Rectangle2D<float> SoftwareGraphics::WorldToScreen(const Rectangle2D<float>& Rect) const
+{
+	if (!UseCamera()) return Rect;
+
+	return Rectangle2D<float>(WorldToScreen(Rect.Position), Vector2D<float>(Rect.Size.X * _Camera.Zoom, Rect.Size.Y * _Camera.Zoom));
+}
+
+void SoftwareGraphics::SetTarget(uint32_t* Pixels, const Vector2D<int>& Size)
+{
+	_TargetPixels = Pixels;
+	_TargetSize = Size;
+	UpdateClipRect();
+}
+
+void SoftwareGraphics::UpdateClipRect()
+{
+	//A render texture is never clip, the screen is clip to the viewport like the SDL renderer
+	Rectangle2D<int> Clip = _bDrawToTexture ? Rectangle2D<int>(Vector2D<int>(0, 0), _TargetSize) : GetViewport();
+
+	int X0 = std::max(Clip.Position.X, 0);
+	int Y0 = std::max(Clip.Position.Y, 0);
+	int X1 = std::min(Clip.Position.X + Clip.Size.X, _TargetSize.X);
+	int Y1 = std::min(Clip.Position.Y + Clip.Size.Y, _TargetSize.Y);
+	_ClipRect = Rectangle2D<int>(Vector2D<int>(X0, Y0), Vector2D<int>(std::max(X1 - X0, 0), std::max(Y1 - Y0, 0)));
+}
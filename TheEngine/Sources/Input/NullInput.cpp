@@ -0,0 +1,68 @@
+#include "Input/NullInput.h"
+
+#include <algorithm>
+
+using namespace NPEngine;
+
+bool NullInput::Initialize(const Param& Params)
+{
+	InitialiseInputData();
+
+	return true;
+}
+
+void NullInput::Shutdown(const Param& Params)
+{
+	ReleaseAll();
+}
+
+bool NullInput::IsKeyDown(EKeyboardKeys Key)
+{
+	if (Key >= EKeyboardKeys::Key_Max) return false;
+	return _KeyStates[Key];
+}
+
+bool NullInput::IsButtonDown(EButtonKeys Key)
+{
+	if (Key >= EButtonKeys::Mouse_Max) return false;
+	return _ButtonStates[Key];
+}
+
+void NullInput::GetMousePosition(int* X, int* Y)
+{
+	if (X) *X = _MousePosition.X;
+	if (Y) *Y = _MousePosition.Y;
+}
+
+Vector2D<int> NullInput::GetMousePosition()
+{
+	return _MousePosition;
+}
+
+void NullInput::SetKeyDown(EKeyboardKeys Key, bool bIsDown)
+{
+	if (Key >= EKeyboardKeys::Key_Max) return;
+	_KeyStates[Key] = bIsDown;
+}
+
+void NullInput::SetButtonDown(EButtonKeys Key, bool bIsDown)
+{
+	if (Key >= EButtonKeys::Mouse_Max) return;
+	_ButtonStates[Key] = bIsDown;
+}
+
+void NullInput::ReleaseAll()
+{
+	std::fill(std::begin(_KeyStates), std::end(_KeyStates), false);
+	std::fill(std::begin(_ButtonStates), std::end(_ButtonStates), false);
+}
+
+void NullInput::ProcessInput()
+{
+	//No device, the state stay as the code set it
+}
+
+void NullInput::UpdateInputListener(float DeltaTime)
+{
+	BroadcastInputChange(DeltaTime);
+}
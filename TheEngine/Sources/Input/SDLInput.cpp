@@ -7,31 +7,7 @@ using namespace NPEngine;
 
 bool SDLInput::Initialize(const Param& Params)
 {
-	for (uint8_t i = 0; i < EKeyboardKeys::Key_Max; i++)
-	{
-		EKeyboardKeys Key = static_cast<EKeyboardKeys>(i);
-		
-		OnKeyPressed[Key] = Delegate<void, const DataKey&>();
-		OnKeyMaintained[Key] = Delegate<void, const DataKey&>();
-		OnKeyReleased[Key] = Delegate<void, const DataKey&>();
-
-		DataKey NewDataKey = DataKey();
-		NewDataKey.Key = Key;
-		_DataKey[Key] = NewDataKey;
-	}
-
-	for (uint8_t i = 0; i < EButtonKeys::Mouse_Max; i++)
-	{
-		EButtonKeys Key = static_cast<EButtonKeys>(i);
-
-		OnButtonPressed[Key] = Delegate<void, const DataButton&>();
-		OnButtonMaintained[Key] = Delegate<void, const DataButton&>();
-		OnButtonReleased[Key] = Delegate<void, const DataButton&>();
-
-		DataButton NewDataButton = DataButton();
-		NewDataButton.Key = Key;
-		_DataButton[Key] = NewDataButton;
-	}
+	InitialiseInputData();
 
 	return true;
 }
@@ -197,61 +173,5 @@ void SDLInput::ProcessInput()
 
 void SDLInput::UpdateInputListener(float DeltaTime)
 {
-	for (uint8_t i = 0; i < EKeyboardKeys::Key_Max; i++)
-	{
-		EKeyboardKeys Key = static_cast<EKeyboardKeys>(i);
-		bool bIsDown = IsKeyDown(Key);
-
-		DataKey& CurrDataKey = _DataKey[Key];
-
-		//On Maintained
-		if (bIsDown && CurrDataKey.bIsPressed)
-		{
-			CurrDataKey.TimePressed += DeltaTime;
-			OnKeyMaintained[Key].Broadcast(CurrDataKey);
-		}
-		//On Pressed
-		else if (bIsDown && !CurrDataKey.bIsPressed)
-		{
-			CurrDataKey.TimePressed = 0.0f;
-			CurrDataKey.bIsPressed = true;
-			OnKeyPressed[Key].Broadcast(CurrDataKey);
-		}
-		//On Released
-		else if (!bIsDown && CurrDataKey.bIsPressed)
-		{
-			CurrDataKey.bIsPressed = false;
-			OnKeyReleased[Key].Broadcast(CurrDataKey);
-			CurrDataKey.TimePressed = 0.0f;
-		}
-	}
-
-	for (uint8_t i = 0; i < EButtonKeys::Mouse_Max; i++)
-	{
-		EButtonKeys Key = static_cast<EButtonKeys>(i);
-		bool bIsDown = IsButtonDown(Key);
-
-		DataButton& CurrDataKey = _DataButton[Key];
-
-		//On Maintained
-		if (bIsDown && CurrDataKey.bIsPressed)
-		{
-			CurrDataKey.TimePressed += DeltaTime;
-			OnButtonMaintained[Key].Broadcast(CurrDataKey);
-		}
-		//On Pressed
-		else if (bIsDown && !CurrDataKey.bIsPressed)
-		{
-			CurrDataKey.TimePressed = 0.0f;
-			CurrDataKey.bIsPressed = true;
-			OnButtonPressed[Key].Broadcast(CurrDataKey);
-		}
-		//On Released
-		else if (!bIsDown && CurrDataKey.bIsPressed)
-		{
-			CurrDataKey.bIsPressed = false;
-			OnButtonReleased[Key].Broadcast(CurrDataKey);
-			CurrDataKey.TimePressed = 0.0f;
-		}
-	}
+	BroadcastInputChange(DeltaTime);
 }
@@ -0,0 +1,190 @@
+#include "Job/JobSystem.h"
+
+#include "Engine.h"
+#include "Logger/ILogger.h"
+#include "Profiler/Profiler.h"
+#include <algorithm>
+
+using namespace NPEngine;
+
+bool JobSystem::Initialize(const Param& Params)
+{
+	_MainThreadId = std::this_thread::get_id();
+	_bStop = false;
+
+	//Keep one core for the main thread
+	int WorkerCount = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+	auto IT = Params.find("WorkerCount");
+	if (IT != Params.end())
+	{
+		WorkerCount = std::any_cast<int>(IT->second);
+	}
+	WorkerCount = std::max(WorkerCount, 1);
+
+	for (int i = 0; i < WorkerCount; i++)
+	{
+		_Workers.emplace_back(&JobSystem::WorkerLoop, this);
+	}
+
+	return true;
+}
+
+void JobSystem::Shutdown(const Param& Params)
+{
+	//The job not started are drop, the started one finish
+	{
+		std::lock_guard<std::mutex> Lock(_JobMutex);
+		_bStop = true;
+		_Jobs.clear();
+	}
+	_JobCondition.notify_all();
+
+	for (std::thread& Worker : _Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	_Workers.clear();
+
+	std::lock_guard<std::mutex> Lock(_MainThreadMutex);
+	_MainThreadJobs.clear();
+}
+
+JobHandle JobSystem::AddJob(const std::function<void()>& Job, const std::function<void()>& OnComplete)
+{
+	JobEntry Entry;
+	Entry.Function = Job;
+	Entry.OnComplete = OnComplete;
+	Entry.bDone = std::make_shared<std::atomic<bool>>(false);
+
+	JobHandle Handle;
+	Handle._bDone = Entry.bDone;
+	Handle._bHasCompletion = OnComplete != nullptr;
+
+	{
+		std::lock_guard<std::mutex> Lock(_JobMutex);
+		_Jobs.push_back(std::move(Entry));
+	}
+	_JobCondition.notify_one();
+
+	return Handle;
+}
+
+void JobSystem::AddMainThreadJob(const std::function<void()>& Job)
+{
+	JobEntry Entry;
+	Entry.OnComplete = Job;
+
+	std::lock_guard<std::mutex> Lock(_MainThreadMutex);
+	_MainThreadJobs.push_back(std::move(Entry));
+}
+
+void JobSystem::Wait(const JobHandle& Handle, bool bCompleteMainThreadJobs)
+{
+	bool bMainThread = IsMainThread() && bCompleteMainThreadJobs;
+
+	//Only the main thread call the completion, the wait never end
+	if (Handle.HasCompletion() && !bMainThread && !Handle.IsDone())
+	{
+		Engine::GetLogger()->LogMessage("Wait on a job with a completion only work on the main thread with the completion call");
+		return;
+	}
+
+	while (!Handle.IsDone())
+	{
+		//Help the worker, the main thread also call the completion it wait for
+		if (TryRunJob()) continue;
+
+		if (bMainThread)
+		{
+			ProcessMainThreadJobs();
+		}
+		std::this_thread::yield();
+	}
+}
+
+int JobSystem::GetWorkerCount() const
+{
+	return static_cast<int>(_Workers.size());
+}
+
+bool JobSystem::IsMainThread() const
+{
+	return std::this_thread::get_id() == _MainThreadId;
+}
+
+void JobSystem::ProcessMainThreadJobs()
+{
+	//Swap the list, a completion can add a new job
+	std::vector<JobEntry> Jobs;
+	{
+		std::lock_guard<std::mutex> Lock(_MainThreadMutex);
+		Jobs.swap(_MainThreadJobs);
+	}
+
+	PROFILE_ZONE("JobSystem::CompleteJobs");
+	for (JobEntry& CurrJob : Jobs)
+	{
+		CurrJob.OnComplete();
+		if (CurrJob.bDone)
+		{
+			CurrJob.bDone->store(true, std::memory_order_release);
+		}
+	}
+}
+
+void JobSystem::WorkerLoop()
+{
+	PROFILE_THREAD("Worker");
+
+	while (true)
+	{
+		JobEntry Job;
+		{
+			std::unique_lock<std::mutex> Lock(_JobMutex);
+			_JobCondition.wait(Lock, [this]() { return _bStop || !_Jobs.empty(); });
+			if (_bStop) return;
+
+			Job = std::move(_Jobs.front());
+			_Jobs.pop_front();
+		}
+
+		RunJob(Job);
+	}
+}
+
+bool JobSystem::TryRunJob()
+{
+	JobEntry Job;
+	{
+		std::lock_guard<std::mutex> Lock(_JobMutex);
+		if (_Jobs.empty()) return false;
+
+		Job = std::move(_Jobs.front());
+		_Jobs.pop_front();
+	}
+
+	RunJob(Job);
+	return true;
+}
+
+void JobSystem::RunJob(JobEntry& Job)
+{
+	if (Job.Function)
+	{
+		PROFILE_ZONE("Job");
+		Job.Function();
+	}
+
+	if (!Job.OnComplete)
+	{
+		Job.bDone->store(true, std::memory_order_release);
+		return;
+	}
+
+	//The completion is call on the main thread
+	std::lock_guard<std::mutex> Lock(_MainThreadMutex);
+	_MainThreadJobs.push_back(std::move(Job));
+}
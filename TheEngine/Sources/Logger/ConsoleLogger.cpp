@@ -1,11 +1,18 @@
 #include "Logger/ConsoleLogger.h"
+#ifdef _WIN32
 #include <windows.h>
-#include <stdio.h>
 #include <consoleapi.h>
+#else
+#include <unistd.h>
+#endif
+#include <stdio.h>
+#include <stdarg.h>
 #include <iostream>
 
 using namespace NPEngine;
 
+#ifdef _WIN32
+
 bool ConsoleLogger::Initialize(const Param& Params)
 {
 	AllocConsole();
@@ -74,4 +81,83 @@ uint8_t ConsoleLogger::MapToBackgroundColor(EColor Color)
 	case EColor::Yellow: return BACKGROUND_RED | BACKGROUND_GREEN;
 	default: return 0;
 	}
-}
\ No newline at end of file
+}
+
+#else
+
+bool ConsoleLogger::Initialize(const Param& Params)
+{
+	_bUseColor = isatty(fileno(stdout)) != 0;
+
+	return true;
+}
+
+void ConsoleLogger::Shutdown(const Param& Params)
+{
+	//Dont leave the terminal with the last color
+	if (_bUseColor)
+	{
+		printf("\033[0m");
+	}
+	fflush(stdout);
+}
+
+void ConsoleLogger::LogMessage(const char* Message, ...)
+{
+	va_list Args;
+	va_start(Args, Message);
+	vprintf(Message, Args);
+	va_end(Args);
+	printf("\n");
+}
+
+void ConsoleLogger::SetTextColor(EColor ForegourndColor, EColor BackgroundColor)
+{
+	if (!_bUseColor) return;
+
+	printf("\033[%u;%um", MapToForegroundColor(ForegourndColor), MapToBackgroundColor(BackgroundColor));
+}
+
+uint8_t ConsoleLogger::MapToForegroundColor(EColor Color)
+{
+	//ANSI color code, 9x are the bright color
+	switch (Color)
+	{
+	case EColor::Black: return 30;
+	case EColor::Blue: return 34;
+	case EColor::Brown: return 33;
+	case EColor::Cyan: return 36;
+	case EColor::Green: return 32;
+	case EColor::Grey: return 37;
+	case EColor::Magenta: return 35;
+	case EColor::Orange: return 33;
+	case EColor::Purple: return 35;
+	case EColor::Red: return 31;
+	case EColor::White: return 97;
+	case EColor::Yellow: return 93;
+	default: return 39;
+	}
+}
+
+uint8_t ConsoleLogger::MapToBackgroundColor(EColor Color)
+{
+	//Black is the default background of the terminal, 10x are the bright color
+	switch (Color)
+	{
+	case EColor::Black: return 49;
+	case EColor::Blue: return 44;
+	case EColor::Brown: return 43;
+	case EColor::Cyan: return 46;
+	case EColor::Green: return 42;
+	case EColor::Grey: return 47;
+	case EColor::Magenta: return 45;
+	case EColor::Orange: return 43;
+	case EColor::Purple: return 45;
+	case EColor::Red: return 41;
+	case EColor::White: return 107;
+	case EColor::Yellow: return 103;
+	default: return 49;
+	}
+}
+
+#endif
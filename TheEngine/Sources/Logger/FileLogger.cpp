@@ -6,7 +6,15 @@ using namespace NPEngine;
 
 bool FileLogger::Initialize(const Param& Params)
 {
-	_File.open("LogFile.txt", std::ios::out | std::ios::trunc);
+	//Each process of a server need is own file
+	std::string Path = "LogFile.txt";
+	auto IT = Params.find("LogPath");
+	if (IT != Params.end())
+	{
+		Path = std::any_cast<std::string>(IT->second);
+	}
+
+	_File.open(Path, std::ios::out | std::ios::trunc);
 
 	return true;
 }
@@ -0,0 +1,176 @@
+#include "Memory/MemoryTracker.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace NPEngine;
+
+//Constant init, the global new can be call before the dynamic init
+std::atomic<uint64_t> MemoryTracker::_AllocationCount = 0;
+std::atomic<uint64_t> MemoryTracker::_LiveBytes[MemoryTag_Count] = {};
+std::atomic<uint64_t> MemoryTracker::_PeakBytes[MemoryTag_Count] = {};
+std::atomic<uint64_t> MemoryTracker::_TotalLiveBytes = 0;
+std::atomic<uint64_t> MemoryTracker::_TotalPeakBytes = 0;
+uint64_t MemoryTracker::_FrameStartCount = 0;
+uint64_t MemoryTracker::_LastFrameAllocations = 0;
+std::atomic<bool> MemoryTracker::_bFailOnAllocation = false;
+thread_local EMemoryTag MemoryTracker::_CurrentTag = MemoryTag_Untagged;
+
+//Keep the biggest value, other thread can change it at the same time
+static void UpdatePeak(std::atomic<uint64_t>& Peak, uint64_t Value)
+{
+	uint64_t CurrPeak = Peak.load(std::memory_order_relaxed);
+	while (Value > CurrPeak && !Peak.compare_exchange_weak(CurrPeak, Value, std::memory_order_relaxed))
+	{
+	}
+}
+
+bool MemoryTracker::IsEnabled()
+{
+#ifdef ENABLE_MEMORY_TRACKING
+	return true;
+#else
+	return false;
+#endif
+}
+
+void MemoryTracker::OnAllocate(size_t Size, EMemoryTag Tag)
+{
+	if (_bFailOnAllocation.load(std::memory_order_relaxed))
+	{
+		//No logger, it allocate
+		_bFailOnAllocation.store(false, std::memory_order_relaxed);
+		fprintf(stderr, "Allocation of %zu bytes in %s while the allocation are not allowed\n", Size, GetTagName(Tag));
+		std::abort();
+	}
+
+	_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+	UpdatePeak(_PeakBytes[Tag], _LiveBytes[Tag].fetch_add(Size, std::memory_order_relaxed) + Size);
+	UpdatePeak(_TotalPeakBytes, _TotalLiveBytes.fetch_add(Size, std::memory_order_relaxed) + Size);
+}
+
+void MemoryTracker::OnFree(size_t Size, EMemoryTag Tag)
+{
+	_LiveBytes[Tag].fetch_sub(Size, std::memory_order_relaxed);
+	_TotalLiveBytes.fetch_sub(Size, std::memory_order_relaxed);
+}
+
+void MemoryTracker::OnEndFrame()
+{
+	uint64_t AllocationCount = GetAllocationCount();
+	_LastFrameAllocations = AllocationCount - _FrameStartCount;
+	_FrameStartCount = AllocationCount;
+}
+
+const char* MemoryTracker::GetTagName(EMemoryTag Tag)
+{
+	switch (Tag)
+	{
+	case MemoryTag_Untagged:
+		return "Untagged";
+	case MemoryTag_World:
+		return "World";
+	case MemoryTag_Physics:
+		return "Physics";
+	case MemoryTag_Graphics:
+		return "Graphics";
+	case MemoryTag_AI:
+		return "AI";
+	case MemoryTag_Gameplay:
+		return "Gameplay";
+	default:
+		return "Unknow";
+	}
+}
+
+#ifdef ENABLE_MEMORY_TRACKING
+
+//Save before each allocation, the free need the size and the tag of the new
+struct AllocationHeader
+{
+public:
+	size_t Size = 0;
+	EMemoryTag Tag = MemoryTag_Untagged;
+};
+
+//Keep the alignment of malloc for the memory after the header
+static const size_t HeaderSize = (sizeof(AllocationHeader) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+static void* TrackedAllocate(size_t Size) noexcept
+{
+	EMemoryTag Tag = MemoryTracker::GetCurrentTag();
+	void* Memory = std::malloc(HeaderSize + Size);
+	if (!Memory) return nullptr;
+
+	AllocationHeader* Header = static_cast<AllocationHeader*>(Memory);
+	Header->Size = Size;
+	Header->Tag = Tag;
+	MemoryTracker::OnAllocate(Size, Tag);
+	return static_cast<char*>(Memory) + HeaderSize;
+}
+
+static void TrackedFree(void* Memory) noexcept
+{
+	if (!Memory) return;
+
+	AllocationHeader* Header = reinterpret_cast<AllocationHeader*>(static_cast<char*>(Memory) - HeaderSize);
+	MemoryTracker::OnFree(Header->Size, Header->Tag);
+	std::free(Header);
+}
+
+void* operator new(size_t Size)
+{
+	void* Memory = TrackedAllocate(Size);
+	if (!Memory) throw std::bad_alloc();
+	return Memory;
+}
+
+void* operator new[](size_t Size)
+{
+	void* Memory = TrackedAllocate(Size);
+	if (!Memory) throw std::bad_alloc();
+	return Memory;
+}
+
+void* operator new(size_t Size, const std::nothrow_t&) noexcept
+{
+	return TrackedAllocate(Size);
+}
+
+void* operator new[](size_t Size, const std::nothrow_t&) noexcept
+{
+	return TrackedAllocate(Size);
+}
+
+void operator delete(void* Memory) noexcept
+{
+	TrackedFree(Memory);
+}
+
+void operator delete[](void* Memory) noexcept
+{
+	TrackedFree(Memory);
+}
+
+void operator delete(void* Memory, size_t Size) noexcept
+{
+	TrackedFree(Memory);
+}
+
+void operator delete[](void* Memory, size_t Size) noexcept
+{
+	TrackedFree(Memory);
+}
+
+void operator delete(void* Memory, const std::nothrow_t&) noexcept
+{
+	TrackedFree(Memory);
+}
+
+void operator delete[](void* Memory, const std::nothrow_t&) noexcept
+{
+	TrackedFree(Memory);
+}
+
+#endif
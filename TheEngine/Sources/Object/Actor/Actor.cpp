@@ -72,14 +72,33 @@ void Actor::BeginPlay()
 
 void Actor::Update(float DeltaTime)
 {
+	//The component with a own group are update by the world
 	for (auto& Value : _UpdatableComponent)
 	{
 		IUpdatableComponent* CurrComponent = Value.second;
-		if (!CurrComponent) continue;
+		if (!CurrComponent || CurrComponent->GetTickGroup() != TickGroup_Count) continue;
 		CurrComponent->Update(DeltaTime);
 	}
 }
 
+void Actor::AddTickFunctions(std::vector<TickFunction>* TickFunctions, std::vector<TickFunction>* ParallelTickFunctions)
+{
+	TickFunction ActorTick = TickFunction();
+	ActorTick.Owner = this;
+	(_bParallelTick ? ParallelTickFunctions : TickFunctions)[_TickGroup].push_back(ActorTick);
+
+	for (auto& Value : _UpdatableComponent)
+	{
+		IUpdatableComponent* CurrComponent = Value.second;
+		if (!CurrComponent || CurrComponent->GetTickGroup() >= TickGroup_Count) continue;
+
+		TickFunction ComponentTick = TickFunction();
+		ComponentTick.Owner = this;
+		ComponentTick.Component = CurrComponent;
+		(CurrComponent->GetParallelTick() ? ParallelTickFunctions : TickFunctions)[CurrComponent->GetTickGroup()].push_back(ComponentTick);
+	}
+}
+
 void Actor::Draw()
 {
 	for (auto& Value : _DrawableComponent)
@@ -90,6 +109,16 @@ void Actor::Draw()
 	}
 }
 
+bool Actor::IsInView(const Rectangle2D<float>& ViewRect) const
+{
+	for (auto& Value : _DrawableComponent)
+	{
+		IDrawableComponent* CurrComponent = Value.second;
+		if (CurrComponent && CurrComponent->IsInView(ViewRect)) return true;
+	}
+	return false;
+}
+
 //---------------------------------------------------------
 
 //Component -----------------------------------------------
@@ -222,6 +251,21 @@ void Actor::SetDrawDepth(unsigned char DrawDepth)
 	Engine::GetWorld()->ResetDrawOrder();
 }
 
+void Actor::SetTickGroup(ETickGroup TickGroup)
+{
+	if (TickGroup >= TickGroup_Count) return;
+	_TickGroup = TickGroup;
+
+	Engine::GetWorld()->ResetTickOrder();
+}
+
+void Actor::SetParallelTick(bool bParallelTick)
+{
+	_bParallelTick = bParallelTick;
+
+	Engine::GetWorld()->ResetTickOrder();
+}
+
 //Getter, setter -----------------------------------------
 
 Component* Actor::GetComponentByName(const std::string& Name) const
@@ -231,6 +275,12 @@ Component* Actor::GetComponentByName(const std::string& Name) const
 	return IT->second;
 }
 
+void Actor::SaveDrawTransform()
+{
+	if (!_TransformComponent) return;
+	_TransformComponent->SaveDrawTransform();
+}
+
 void Actor::SetPosition(const Vector2D<float>& Position)
 {
 	if (!_TransformComponent) return;
@@ -5,6 +5,7 @@
 
 #include <fstream>
 #include <sstream>
+#include <algorithm>
 
 using namespace NPEngine;
 
@@ -45,6 +46,8 @@ bool TileMap::Initialise(const Param& Params)
 		_CellSize = std::any_cast<Vector2D<float>>(IT->second);
 	}
 
+	CreateChunks();
+
 	return true;
 }
 
@@ -52,7 +55,14 @@ void TileMap::Destroy(const Param& Params)
 {
 	Actor::Destroy(Params);
 
+	DestroyChunks();
 
+	//The tile set can be evict after the map
+	if (Engine::GetGraphics())
+	{
+		Engine::GetGraphics()->ReleaseTexture(_TileSetID);
+	}
+	_TileSetID = 0;
 }
 
 void TileMap::BeginPlay()
@@ -82,33 +92,212 @@ Actor* TileMap::Clone(const std::string& Name, const Param& Params)
 
 void TileMap::Draw()
 {
+	//The chunk texture are empty after a device reset
+	uint32_t RenderTargetGeneration = Engine::GetGraphics()->GetRenderTargetGeneration();
+	if (RenderTargetGeneration != _RenderTargetGeneration)
+	{
+		for (TileChunk& CurrChunk : _Chunks)
+		{
+			CurrChunk.bDirty = true;
+		}
+		_RenderTargetGeneration = RenderTargetGeneration;
+	}
+
+	//Only the chunk in the camera view are draw
+	Rectangle2D<float> ViewRect = Engine::GetGraphics()->GetViewRect();
+	Vector2D<float> ChunkPixelSize = Vector2D<float>(_CellSize.X * _ChunkSize, _CellSize.Y * _ChunkSize);
+
+	if (ChunkPixelSize.X > 0.0f && ChunkPixelSize.Y > 0.0f)
+	{
+		int FirstChunkX = std::max(static_cast<int>(std::floor(ViewRect.Position.X / ChunkPixelSize.X)), 0);
+		int FirstChunkY = std::max(static_cast<int>(std::floor(ViewRect.Position.Y / ChunkPixelSize.Y)), 0);
+		int LastChunkX = std::min(static_cast<int>(std::floor((ViewRect.Position.X + ViewRect.Size.X) / ChunkPixelSize.X)), _ChunkCount.X - 1);
+		int LastChunkY = std::min(static_cast<int>(std::floor((ViewRect.Position.Y + ViewRect.Size.Y) / ChunkPixelSize.Y)), _ChunkCount.Y - 1);
+
+		for (int ChunkY = FirstChunkY; ChunkY <= LastChunkY; ChunkY++)
+		{
+			for (int ChunkX = FirstChunkX; ChunkX <= LastChunkX; ChunkX++)
+			{
+				TileChunk& CurrChunk = _Chunks[ChunkY * _ChunkCount.X + ChunkX];
+				if (CurrChunk.bDirty)
+				{
+					//Wait the tile set, a chunk bake without it is empty
+					if (!Engine::GetGraphics()->IsTextureLoaded(_TileSetID)) continue;
+					BakeChunk(CurrChunk);
+				}
+
+				Rectangle2D<float> CurrDrawRectangle = Rectangle2D<float>(
+					Vector2D<float>(CurrChunk.FirstTile.X * _CellSize.X, CurrChunk.FirstTile.Y * _CellSize.Y),
+					Vector2D<float>(CurrChunk.TileCount.X * _CellSize.X, CurrChunk.TileCount.Y * _CellSize.Y));
+				Engine::GetGraphics()->DrawTexture(CurrChunk.TextureId, CurrDrawRectangle);
+			}
+		}
+	}
+
+	Actor::Draw();
+}
+
+void TileMap::SetTile(int Layer, int Row, int Column, int Value)
+{
+	if (Layer < 0 || Layer >= static_cast<int>(_TileMap.size())) return;
+	if (Row < 0 || Row >= static_cast<int>(_TileMap[Layer].size())) return;
+	if (Column < 0 || Column >= static_cast<int>(_TileMap[Layer][Row].size())) return;
+	if (_TileMap[Layer][Row][Column] == Value) return;
+
+	_TileMap[Layer][Row][Column] = Value;
+
+	//Bake the chunk again on next draw
+	int ChunkIndex = (Row / _ChunkSize) * _ChunkCount.X + (Column / _ChunkSize);
+	if (ChunkIndex < static_cast<int>(_Chunks.size()))
+	{
+		_Chunks[ChunkIndex].bDirty = true;
+	}
+
+	//Update the collision if the layer collide
+	if (std::find(_CollisionLayer.begin(), _CollisionLayer.end(), Layer) != _CollisionLayer.end())
+	{
+		UpdateCollisionGrid();
+	}
+}
+
+void TileMap::UpdateCollisionGrid()
+{
+	//The collision is create at begin play
+	PhysicsComponent* CurrPhysicsComponent = GetComponentOfClass<PhysicsComponent>();
+	if (CurrPhysicsComponent && CurrPhysicsComponent->GetCollision())
+	{
+		GridCollision* CurrGridCollision = static_cast<GridCollision*>(CurrPhysicsComponent->GetCollision());
+		CurrGridCollision->SetGrid(GetCollisionGrid());
+	}
+}
+
+int TileMap::GetTile(int Layer, int Row, int Column) const
+{
+	if (Layer < 0 || Layer >= static_cast<int>(_TileMap.size())) return -1;
+	if (Row < 0 || Row >= static_cast<int>(_TileMap[Layer].size())) return -1;
+	if (Column < 0 || Column >= static_cast<int>(_TileMap[Layer][Row].size())) return -1;
+
+	return _TileMap[Layer][Row][Column];
+}
+
+Rectangle2D<float> TileMap::GetBounds() const
+{
+	if (_TileMap.empty() || _TileMap[0].empty()) return Rectangle2D<float>(GetPosition(), Vector2D<float>(0.0f, 0.0f));
+
+	Vector2D<float> Size = Vector2D<float>(static_cast<float>(_TileMap[0][0].size()) * _CellSize.X, static_cast<float>(_TileMap[0].size()) * _CellSize.Y);
+	return Rectangle2D<float>(GetPosition(), Size);
+}
+
+void TileMap::CreateChunks()
+{
+	DestroyChunks();
+
+	//Get the biggest size of all layer
+	Vector2D<int> TileCount = Vector2D<int>(0, 0);
+	for (const std::vector<std::vector<int>>& CurrLayer : _TileMap)
+	{
+		TileCount.Y = std::max(TileCount.Y, static_cast<int>(CurrLayer.size()));
+		for (const std::vector<int>& CurrRow : CurrLayer)
+		{
+			TileCount.X = std::max(TileCount.X, static_cast<int>(CurrRow.size()));
+		}
+	}
+
+	_ChunkCount.X = (TileCount.X + _ChunkSize - 1) / _ChunkSize;
+	_ChunkCount.Y = (TileCount.Y + _ChunkSize - 1) / _ChunkSize;
+
+	for (int ChunkY = 0; ChunkY < _ChunkCount.Y; ChunkY++)
+	{
+		for (int ChunkX = 0; ChunkX < _ChunkCount.X; ChunkX++)
+		{
+			TileChunk NewChunk;
+			NewChunk.FirstTile = Vector2D<int>(ChunkX * _ChunkSize, ChunkY * _ChunkSize);
+			NewChunk.TileCount.X = std::min(_ChunkSize, TileCount.X - NewChunk.FirstTile.X);
+			NewChunk.TileCount.Y = std::min(_ChunkSize, TileCount.Y - NewChunk.FirstTile.Y);
+			_Chunks.push_back(NewChunk);
+		}
+	}
+}
+
+void TileMap::BakeChunk(TileChunk& Chunk)
+{
+	Vector2D<int> CellSizeInt = Vector2D<int>(static_cast<int>(_CellSize.X), static_cast<int>(_CellSize.Y));
+
+	//The texture is create the first time we draw the chunk, the renderer is ready
+	if (!Chunk.bTextureCreated)
+	{
+		Vector2D<int> TextureSize = Vector2D<int>(Chunk.TileCount.X * CellSizeInt.X, Chunk.TileCount.Y * CellSizeInt.Y);
+		Chunk.TextureId = Engine::GetGraphics()->CreateRenderTexture(TextureSize);
+		Chunk.bTextureCreated = true;
+	}
+
+	if (!Engine::GetGraphics()->BeginDrawToTexture(Chunk.TextureId)) return;
+
+	//Draw all layer in order, the position is relative to the chunk
 	for (const std::vector<std::vector<int>>& CurrLayer : _TileMap)
 	{
 		Rectangle2D<float> CurrDrawRectangle = Rectangle2D<float>(Vector2D<float>(0.0f, 0.0f), _CellSize);
 
-		for (const std::vector<int>& CurrRow : CurrLayer)
+		int LastRow = std::min(Chunk.FirstTile.Y + Chunk.TileCount.Y, static_cast<int>(CurrLayer.size()));
+		for (int Y = Chunk.FirstTile.Y; Y < LastRow; Y++)
 		{
-			CurrDrawRectangle.Position.X = 0;
-			for (const int& Cell : CurrRow)
+			const std::vector<int>& CurrRow = CurrLayer[Y];
+			CurrDrawRectangle.Position.Y = (Y - Chunk.FirstTile.Y) * _CellSize.Y;
+
+			int LastColumn = std::min(Chunk.FirstTile.X + Chunk.TileCount.X, static_cast<int>(CurrRow.size()));
+			for (int X = Chunk.FirstTile.X; X < LastColumn; X++)
 			{
-				Vector2D<int> CellSizeInt = Vector2D<int>(static_cast<int>(_CellSize.X), static_cast<int>(_CellSize.Y));
-				Engine::GetGraphics()->DrawTextureTile(_TileSetID, CurrDrawRectangle, CellSizeInt, Cell);
-				CurrDrawRectangle.Position.X += _CellSize.X;
+				if (CurrRow[X] < 0) continue;
+
+				CurrDrawRectangle.Position.X = (X - Chunk.FirstTile.X) * _CellSize.X;
+				Engine::GetGraphics()->DrawTextureTile(_TileSetID, CurrDrawRectangle, CellSizeInt, CurrRow[X]);
 			}
-			CurrDrawRectangle.Position.Y += _CellSize.Y;
 		}
 	}
 
-	Actor::Draw();
+	Engine::GetGraphics()->EndDrawToTexture();
+	Chunk.bDirty = false;
+}
+
+void TileMap::DestroyChunks()
+{
+	if (Engine::GetGraphics())
+	{
+		for (TileChunk& CurrChunk : _Chunks)
+		{
+			if (CurrChunk.bTextureCreated)
+			{
+				Engine::GetGraphics()->UnloadTexture(CurrChunk.TextureId);
+			}
+		}
+	}
+	_Chunks.clear();
+	_ChunkCount = Vector2D<int>(0, 0);
 }
 
 void TileMap::LoadTileSet(const std::string& TileSetPath)
 {
-	_TileSetID = Engine::GetGraphics()->LoadTexture(TileSetPath.c_str());
+	Engine::GetGraphics()->ReleaseTexture(_TileSetID);
+	_TileSetID = Engine::GetGraphics()->LoadTextureAsync(TileSetPath);
+	//Keep for all the map, a chunk bake again need it
+	Engine::GetGraphics()->AcquireTexture(_TileSetID);
 }
 
 void TileMap::LoadTileMap(const std::vector<std::string>& LayerPath)
 {
+	//The csv are small, only the tile set is load on a worker
+	std::vector<std::vector<std::vector<int>>> Layers;
+	if (!ReadTileMap(LayerPath, &Layers))
+	{
+		return;
+	}
+	_TileMap = std::move(Layers);
+}
+
+bool TileMap::ReadTileMap(const std::vector<std::string>& LayerPath, std::vector<std::vector<std::vector<int>>>* OutLayers)
+{
+	std::vector<std::vector<std::vector<int>>> Layers;
+
 	for (const std::string& EndPath : LayerPath)
 	{
 		std::string CurrPath = std::string("./Assets/TileMap/") + EndPath;
@@ -129,16 +318,27 @@ void TileMap::LoadTileMap(const std::vector<std::string>& LayerPath)
 				{
 					if (!Cell.empty()) 
 					{
-						Row.push_back(std::stoi(Cell));
+						try
+						{
+							Row.push_back(std::stoi(Cell));
+						}
+						catch (const std::exception&)
+						{
+							Engine::GetLogger()->LogMessage("The tile %s in %s is not a number", Cell.c_str(), CurrPath.c_str());
+							return false;
+						}
 					}
 				}
 
 				Layer.push_back(Row);
 			}
-			_TileMap.push_back(Layer);
+			Layers.push_back(Layer);
 			File.close();
 		}
 	}
+
+	*OutLayers = std::move(Layers);
+	return true;
 }
 
 std::vector<std::vector<bool>> TileMap::GetCollisionGrid() const
@@ -152,11 +352,11 @@ std::vector<std::vector<bool>> TileMap::GetCollisionGrid() const
 
 	for (const int& LayerIndex : _CollisionLayer) 
 	{
-		if (LayerIndex < _TileMap.size()) 
+		if (LayerIndex < static_cast<int>(_TileMap.size())) 
 		{
-			for (int Y = 0; Y < _TileMap[LayerIndex].size(); Y++)
+			for (int Y = 0; Y < static_cast<int>(_TileMap[LayerIndex].size()); Y++)
 			{
-				for (int X = 0; X < _TileMap[LayerIndex][Y].size(); X++)
+				for (int X = 0; X < static_cast<int>(_TileMap[LayerIndex][Y].size()); X++)
 				{
 					if (_TileMap[LayerIndex][Y][X] != -1 && !CollisionGrid[Y][X]) 
 					{
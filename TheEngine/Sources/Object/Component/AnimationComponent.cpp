@@ -1,4 +1,6 @@
 #include "Object/Component/AnimationComponent.h"
+#include "Engine.h"
+#include <algorithm>
 
 using namespace NPEngine;
 
@@ -6,88 +8,135 @@ AnimationComponent::AnimationComponent(const std::string& Name) : AtlasComponent
 {
 }
 
-void AnimationComponent::AddAnimation(const std::string& AnimationName, AnimationData& NewAnimationData)
+int AnimationComponent::AddAnimation(const std::string& AnimationName, const AnimationData& NewAnimationData)
 {
-	NewAnimationData.AnimationName = AnimationName;
-	_Animations[AnimationName] = NewAnimationData;
+	if (_ClipIds.find(AnimationName) != _ClipIds.end()) return -1;
+
+	int ClipId = static_cast<int>(_Clips.size());
+
+	AnimationClip NewClip = AnimationClip();
+	NewClip.Name = AnimationName;
+	NewClip.FrameInterval = NewAnimationData.FrameInterval;
+	NewClip.StartIndex = NewAnimationData.StartIndex;
+	NewClip.EndIndex = NewAnimationData.EndIndex;
+	NewClip.bLoop = NewAnimationData.bLoop;
+	NewClip.AnimationFlip = NewAnimationData.AnimationFlip;
+	NewClip.SwitchIndex = NewAnimationData.SwitchAnimationData.SwitchIndex;
+	NewClip.FramesToCallObserver = NewAnimationData.FramesToCallObserver;
+
+	std::string SwitchName = NewAnimationData.SwitchAnimationData.bSwitchAnimation ? NewAnimationData.SwitchAnimationData.SwitchAnimationName : std::string();
+	if (!SwitchName.empty())
+	{
+		NewClip.SwitchClipId = SwitchName == AnimationName ? ClipId : GetAnimationId(SwitchName);
+	}
+
+	//The clip added before can switch to this one
+	for (size_t i = 0; i < _Clips.size(); i++)
+	{
+		if (_Clips[i].SwitchClipId == -1 && _SwitchNames[i] == AnimationName)
+		{
+			_Clips[i].SwitchClipId = ClipId;
+		}
+	}
+
+	_Clips.push_back(NewClip);
+	_SwitchNames.push_back(SwitchName);
+	_ClipIds[AnimationName] = ClipId;
+
+	return ClipId;
 }
 
-void AnimationComponent::RemoveAnimation(const std::string& AnimationName)
+int AnimationComponent::GetAnimationId(const std::string& AnimationName) const
 {
-	_Animations.erase(AnimationName);
+	auto IT = _ClipIds.find(AnimationName);
+	if (IT == _ClipIds.end()) return -1;
+	return IT->second;
 }
 
-AnimationData& AnimationComponent::GetAnimationData(const std::string& AnimationName)
+const AnimationClip* AnimationComponent::GetAnimationClip(int ClipId) const
 {
-	auto IT = _Animations.find(AnimationName);
-	if (IT == _Animations.end()) return _BaseAnimationData;
-	return IT->second;
+	if (ClipId < 0 || ClipId >= static_cast<int>(_Clips.size())) return nullptr;
+	return &_Clips[ClipId];
+}
+
+void AnimationComponent::SetCurrentAnimation(int ClipId)
+{
+	const AnimationClip* Clip = GetAnimationClip(ClipId);
+	if (!Clip) return;
+
+	PlayClip(ClipId);
+	NotifyObserver(*Clip);
+}
+
+void AnimationComponent::SetCurrentAnimation(const std::string& AnimationName)
+{
+	SetCurrentAnimation(GetAnimationId(AnimationName));
 }
 
-void AnimationComponent::SetCurrentAnimation(const std::string AnimationName)
+bool AnimationComponent::Initialise(const Param& Params)
 {
-	auto ITAnimation = _Animations.find(AnimationName);
-	if (ITAnimation == _Animations.end()) return;
+	bool bSucces = AtlasComponent::Initialise(Params);
 
-	_CurrentAnimation = ITAnimation->second;
-	_CurrentFrameTime = 0.0f;
-	SetTileIndex(_CurrentAnimation.StartIndex);
-	SetFlip(_CurrentAnimation.AnimationFlip);
+	_AnimationSlot = Engine::GetWorld()->GetAnimationSystem()->AddComponent(this);
 
-	auto IT = _CurrentAnimation.FrameToCallObserver.find(GetTileIndex());
-	if (IT != _CurrentAnimation.FrameToCallObserver.end())
+	return bSucces;
+}
+
+void AnimationComponent::Destroy(const Param& Params)
+{
+	AtlasComponent::Destroy(Params);
+
+	if (_AnimationSlot != -1)
 	{
-		_CurrentAnimation.AnimationObserver.Broadcast(GetTileIndex(), _CurrentAnimation.AnimationName);
+		Engine::GetWorld()->GetAnimationSystem()->RemoveComponent(_AnimationSlot);
+		_AnimationSlot = -1;
 	}
 }
 
-void AnimationComponent::Update(float DeltaTime)
+void AnimationComponent::PlayClip(int ClipId)
 {
-	if (GetTileIndex() == _CurrentAnimation.EndIndex && !_CurrentAnimation.bLoop) return;
+	const AnimationClip* Clip = GetAnimationClip(ClipId);
+	if (!Clip) return;
 
-	_CurrentFrameTime += DeltaTime;
+	_CurrentClipId = ClipId;
+	SetTileIndex(Clip->StartIndex);
+	SetFlip(Clip->AnimationFlip);
 
-	if (_CurrentFrameTime >= _CurrentAnimation.FrameInterval)
+	if (_AnimationSlot != -1)
 	{
-		_CurrentFrameTime = 0.0f;
+		Engine::GetWorld()->GetAnimationSystem()->SetClip(_AnimationSlot, ClipId, Clip);
+	}
+}
 
-		if (_CurrentAnimation.SwitchAnimationData.bSwitchAnimation && GetTileIndex() == _CurrentAnimation.SwitchAnimationData.SwitchIndex)
-		{
-			SetCurrentAnimation(_CurrentAnimation.SwitchAnimationData.SwitchAnimationName);
-		}
-		else
-		{
-			if (GetTileIndex() >= _CurrentAnimation.EndIndex)
-			{
-				SetTileIndex(_CurrentAnimation.StartIndex);
-			}
-			else
-			{
-				SetTileIndex(GetTileIndex() + 1);
-			}
-
-			auto IT = _CurrentAnimation.FrameToCallObserver.find(GetTileIndex());
-			if (IT != _CurrentAnimation.FrameToCallObserver.end() && IT->second)
-			{
-				_CurrentAnimation.AnimationObserver.Broadcast(GetTileIndex(), _CurrentAnimation.AnimationName);
-			}
-		}
+void AnimationComponent::NotifyObserver(const AnimationClip& Clip)
+{
+	if (Clip.CallObserverAt(GetTileIndex()))
+	{
+		AnimationObserver.Broadcast(GetTileIndex(), _CurrentClipId);
 	}
 }
 
 //------------------------------------------------------------------
 
+bool AnimationClip::CallObserverAt(int Frame) const
+{
+	return std::find(FramesToCallObserver.begin(), FramesToCallObserver.end(), Frame) != FramesToCallObserver.end();
+}
+
+//------------------------------------------------------------------
+
 void AnimationData::AddFrameToCallObserver(int Frame)
 {
-	FrameToCallObserver[Frame] = true;
+	if (std::find(FramesToCallObserver.begin(), FramesToCallObserver.end(), Frame) != FramesToCallObserver.end()) return;
+	FramesToCallObserver.push_back(Frame);
 }
 
 void AnimationData::RemoveFrameToCallObserver(int Frame)
 {
-	FrameToCallObserver.erase(Frame);
+	FramesToCallObserver.erase(std::remove(FramesToCallObserver.begin(), FramesToCallObserver.end(), Frame), FramesToCallObserver.end());
 }
 
 void AnimationData::ClearAllFrameToCallObserver()
 {
-	FrameToCallObserver.clear();
+	FramesToCallObserver.clear();
 }
@@ -26,6 +26,6 @@ void AtlasComponent::Draw()
 
 	if (_bTextureIsLoaded)
 	{
-		Engine::GetGraphics()->DrawTextureTile(_TextureID, Rectangle2D<float>(GetPosition(), GetSize()), _TileSize, _CurrTileIndex, Color::White, 0.0f, _Flip);
+		Engine::GetGraphics()->DrawTextureTile(_TextureID, GetDrawRectangle(), _TileSize, _CurrTileIndex, Color::White, 0.0f, _Flip);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,18 @@
+#include "Object/Component/IUpdatableComponent.h"
+#include "Engine.h"
+
+using namespace NPEngine;
+
+void IUpdatableComponent::SetTickGroup(ETickGroup TickGroup)
+{
+	_TickGroup = TickGroup;
+
+	Engine::GetWorld()->ResetTickOrder();
+}
+
+void IUpdatableComponent::SetParallelTick(bool bParallelTick)
+{
+	_bParallelTick = bParallelTick;
+
+	Engine::GetWorld()->ResetTickOrder();
+}
@@ -29,6 +29,13 @@ bool PhysicsComponent::Initialise(const Param& Params)
 		}
 	}
 
+	//Start velocity, for the actor spawn in movement
+	IT = Params.find("Velocity");
+	if (IT != Params.end())
+	{
+		SetVelocity(std::any_cast<Vector2D<float>>(IT->second));
+	}
+
 	IPhysics* Physics = Engine::GetPhysics();
 	if (Physics)
 	{
@@ -130,18 +137,6 @@ void PhysicsComponent::ApplyVelocity(float DeltaTime)
 	SetVelocity(Vector2D<float>(0.0f, 0.0f));
 }
 
-std::vector<CollisionData> PhysicsComponent::CheckCollision()
-{
-	std::vector<CollisionData> CollisionsData = Engine::GetPhysics()->CheckCollisionWith(GetCollision());
-
-	if (!CollisionsData.empty())
-	{
-		OnCollision.Broadcast(CollisionsData);
-	}
-	
-	return CollisionsData;
-}
-
 void PhysicsComponent::CorrectMovement(const std::vector<CollisionData>& AllCollisionData)
 {
 	if (!_bCorrectMovement) return;
@@ -11,7 +11,15 @@ SpriteComponent::SpriteComponent(const std::string& Name) : Component(Name)
 
 void SpriteComponent::LoadTexture(const std::string& TexturePath)
 {
-	_TextureID = Engine::GetGraphics()->LoadTexture(TexturePath.c_str());
+	//The old texture can be evict now
+	if (_bTextureIsLoaded)
+	{
+		Engine::GetGraphics()->ReleaseTexture(_TextureID);
+	}
+
+	//The texture is draw when the worker finish to load it
+	_TextureID = Engine::GetGraphics()->LoadTextureAsync(TexturePath);
+	Engine::GetGraphics()->AcquireTexture(_TextureID);
 	_bTextureIsLoaded = true;
 }
 
@@ -29,16 +37,39 @@ bool SpriteComponent::Initialise(const Param& Params)
 	return true;
 }
 
+void SpriteComponent::Destroy(const Param& Params)
+{
+	Component::Destroy(Params);
+
+	if (_bTextureIsLoaded && Engine::GetGraphics())
+	{
+		Engine::GetGraphics()->ReleaseTexture(_TextureID);
+		_bTextureIsLoaded = false;
+	}
+}
+
 void SpriteComponent::Draw()
 {
 	if (!_bDraw) return;
 
 	if (_bTextureIsLoaded)
 	{
-		Engine::GetGraphics()->DrawTexture(_TextureID, Rectangle2D<float>(GetPosition(), GetSize()), Color::White, 0.0f, _Flip);
+		Engine::GetGraphics()->DrawTexture(_TextureID, GetDrawRectangle(), Color::White, 0.0f, _Flip);
 	}
 }
 
+bool SpriteComponent::IsInView(const Rectangle2D<float>& ViewRect) const
+{
+	if (!_bDraw || !_bTextureIsLoaded) return false;
+
+	Rectangle2D<float> DrawRectangle = GetDrawRectangle();
+	Vector2D<float> Position = DrawRectangle.Position;
+	Vector2D<float> Size = DrawRectangle.Size;
+
+	return Position.X < ViewRect.Position.X + ViewRect.Size.X && Position.X + Size.X > ViewRect.Position.X
+		&& Position.Y < ViewRect.Position.Y + ViewRect.Size.Y && Position.Y + Size.Y > ViewRect.Position.Y;
+}
+
 Vector2D<float> SpriteComponent::GetPosition() const
 {
 	Vector2D<float> Position = Vector2D<float>(0.0f, 0.0f);
@@ -72,3 +103,20 @@ Vector2D<float> SpriteComponent::GetSize() const
 
 	return Size;
 }
+
+Rectangle2D<float> SpriteComponent::GetDrawRectangle() const
+{
+	Rectangle2D<float> DrawRectangle = Rectangle2D<float>(_OffsetPosition, _OffsetSize);
+
+	if (_OwnerActor)
+	{
+		TransformComponent* CurrTransformComponent = _OwnerActor->GetComponentOfClass<TransformComponent>();
+		if (CurrTransformComponent)
+		{
+			DrawRectangle.Position += CurrTransformComponent->GetDrawPosition();
+			DrawRectangle.Size += CurrTransformComponent->GetDrawSize();
+		}
+	}
+
+	return DrawRectangle;
+}
@@ -183,9 +183,19 @@ CollisionData BoxCollision::CheckCollisionWithGrid(const ICollision& OtherCollis
 
 void BoxCollision::DrawCollision()
 {
-    Rectangle2D<float> CurrRectangle = Rectangle2D<float>(GetPosition(), GetSize());
+    //The draw use the transform save for the render, the physics can move the actor at the same time
+    Rectangle2D<float> CurrRectangle = Rectangle2D<float>(_PositionOffset, _SizeOffset);
+    if (_OwnerActor)
+    {
+        TransformComponent* CurrTransformComponent = _OwnerActor->GetComponentOfClass<TransformComponent>();
+        if (CurrTransformComponent)
+        {
+            CurrRectangle.Position += CurrTransformComponent->GetDrawPosition();
+            CurrRectangle.Size += CurrTransformComponent->GetDrawSize();
+        }
+    }
 
-    Engine::GetGraphics()->DrawRect(CurrRectangle);
+    Engine::GetDebugDraw()->DrawRect(CurrRectangle);
 }
 
 Vector2D<float> BoxCollision::GetPosition() const
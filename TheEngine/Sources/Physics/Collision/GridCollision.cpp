@@ -63,16 +63,33 @@ std::vector<Vector2D<int>> GridCollision::GetIndexInRect(const Rectangle2D<float
 
 void GridCollision::DrawCollision()
 {
+    //Same rect as GetBoxCollisionAt, without create a box per cell
+    Vector2D<float> Origin = _PositionOffset;
+    Vector2D<float> CellRectSize = _CellSize;
+    if (_OwnerActor)
+    {
+        TransformComponent* CurrTransformComponent = _OwnerActor->GetComponentOfClass<TransformComponent>();
+        if (CurrTransformComponent)
+        {
+            Origin += CurrTransformComponent->GetDrawPosition();
+            CellRectSize += CurrTransformComponent->GetDrawSize();
+        }
+    }
+
+    DebugDraw* CurrDebugDraw = Engine::GetDebugDraw();
+    Rectangle2D<float> CellRect = Rectangle2D<float>(Origin, CellRectSize);
+
     int Y = 0;
-    for (std::vector<bool>& Lines : _Grid)
+    for (const std::vector<bool>& Lines : _Grid)
     {
         int X = 0;
         for (bool IsCollide : Lines)
         {
             if (IsCollide)
             {
-                BoxCollision CurrBoxCollision = GetBoxCollisionAt(Vector2D<int>(X, Y));
-                CurrBoxCollision.DrawCollision();
+                CellRect.Position.X = Origin.X + _CellSize.X * X;
+                CellRect.Position.Y = Origin.Y + _CellSize.Y * Y;
+                CurrDebugDraw->DrawRect(CellRect);
             }
             X++;
         }
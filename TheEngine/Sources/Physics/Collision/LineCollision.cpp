@@ -45,7 +45,18 @@ CollisionData LineCollision::CheckCollisionWithGrid(const ICollision& OtherColli
 
 void LineCollision::DrawCollision()
 {
-    Engine::GetGraphics()->DrawLine(GetStartPoint(), GetEndPoint());
+    //The draw use the transform save for the render, the physics can move the actor at the same time
+    Vector2D<float> DrawPosition = Vector2D<float>(0.0f, 0.0f);
+    if (_Owner)
+    {
+        TransformComponent* CurrTransformComponent = _Owner->GetComponentOfClass<TransformComponent>();
+        if (CurrTransformComponent)
+        {
+            DrawPosition = CurrTransformComponent->GetDrawPosition();
+        }
+    }
+
+    Engine::GetDebugDraw()->DrawLine(DrawPosition + _StartPointOffset, DrawPosition + _EndPointOffset);
 }
 
 Vector2D<float> LineCollision::GetStartPoint() const
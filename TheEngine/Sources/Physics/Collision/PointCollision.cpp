@@ -46,7 +46,18 @@ CollisionData PointCollision::CheckCollisionWithGrid(const ICollision& OtherColl
 
 void PointCollision::DrawCollision()
 {
-    Engine::GetGraphics()->DrawPoint(GetPosition());
+    //The draw use the transform save for the render, the physics can move the actor at the same time
+    Vector2D<float> CurrPoint = _PositionOffset;
+    if (_Owner)
+    {
+        TransformComponent* CurrTransformComponent = _Owner->GetComponentOfClass<TransformComponent>();
+        if (CurrTransformComponent)
+        {
+            CurrPoint += CurrTransformComponent->GetDrawPosition();
+        }
+    }
+
+    Engine::GetDebugDraw()->DrawPoint(CurrPoint);
 }
 
 void PointCollision::SetPositionOffset(const Vector2D<float>& PositionOffset)
@@ -45,7 +45,18 @@ CollisionData SphereCollision::CheckCollisionWithGrid(const ICollision& OtherCol
 
 void SphereCollision::DrawCollision()
 {
-    Engine::GetGraphics()->DrawCircle(GetPosition(), _Ray);
+    //The draw use the transform save for the render, the physics can move the actor at the same time
+    Vector2D<float> CurrPosition = _PositionOffset;
+    if (_Owner)
+    {
+        TransformComponent* CurrTransformComponent = _Owner->GetComponentOfClass<TransformComponent>();
+        if (CurrTransformComponent)
+        {
+            CurrPosition += CurrTransformComponent->GetDrawPosition();
+        }
+    }
+
+    Engine::GetDebugDraw()->DrawCircle(CurrPosition, _Ray);
 }
 
 void SphereCollision::SetPositionOffset(const Vector2D<float>& PositionOffset)
@@ -2,6 +2,11 @@
 #include "Object/Actor/Actor.h"
 #include "Object/Component/PhysicsComponent.h"
 #include "Physics/Collision/ICollision.h"
+#include "Profiler/Profiler.h"
+#include "Engine.h"
+#include "Memory/MemoryTracker.h"
+
+#include <algorithm>
 
 using namespace NPEngine;
 
@@ -12,44 +17,116 @@ bool Physics::Initialize(const Param& Params)
 
 void Physics::Shutdown(const Param& Params)
 {
+    FinishPhysics();
+    _PendingCollisions.clear();
 }
 
 void Physics::UpdatePhysics(float DeltaTime)
 {
-    std::map<PhysicsComponent*, std::vector<CollisionData>> MapCurrentCollision;
+    FinishPhysics();
+    Simulate(DeltaTime);
+    ResolveCollisions();
+}
 
-    for (auto& IT : _PhysicsActors)
+void Physics::StartPhysics(float DeltaTime)
+{
+    FinishPhysics();
+    //No completion, the delegate are call on the main thread by ResolveCollisions
+    _SimulateJob = Engine::GetJobSystem()->AddJob([this, DeltaTime]()
+    {
+        Simulate(DeltaTime);
+    });
+}
+
+void Physics::FinishPhysics()
+{
+    if (!_SimulateJob.IsValid()) return;
+
+    PROFILE_ZONE("Physics::FinishPhysics");
+    //Dont call the completion, they can change the tile map read by the job
+    Engine::GetJobSystem()->Wait(_SimulateJob, false);
+    _SimulateJob = JobHandle();
+}
+
+void Physics::Simulate(float DeltaTime)
+{
+    //Also on the worker of the pipelined frame
+    MEMORY_SCOPE(MemoryTag_Physics);
+    _PendingCollisions.clear();
+
+    //One zone per pass, the zone end with the scope
     {
-        PhysicsComponent* CurrPhysicsComponent = IT.second;
-        if(!CurrPhysicsComponent) continue;
+        PROFILE_ZONE("Physics::MoveAndCheckCollision");
+        for (auto& IT : _PhysicsActors)
+        {
+            PhysicsComponent* CurrPhysicsComponent = IT.second;
+            if(!CurrPhysicsComponent) continue;
 
-		CurrPhysicsComponent->ApplyVelocity(DeltaTime);
+            CurrPhysicsComponent->ApplyVelocity(DeltaTime);
 
-        if (CurrPhysicsComponent->GetIsCalculeCollision())
+            if (CurrPhysicsComponent->GetIsCalculeCollision())
+            {
+                _PendingCollisions.emplace_back(CurrPhysicsComponent, CheckCollisionWith(CurrPhysicsComponent->GetCollision()));
+            }
+        }
+    }
+
+    {
+        PROFILE_ZONE("Physics::CorrectMovement");
+        for (auto& IT : _PendingCollisions)
         {
-            std::vector<CollisionData> CurrCollisionsData = CurrPhysicsComponent->CheckCollision();
-            MapCurrentCollision[CurrPhysicsComponent] = CurrCollisionsData;
+            IT.first->CorrectMovement(IT.second);
         }
     }
+}
+
+void Physics::ResolveCollisions()
+{
+    FinishPhysics();
 
-    for (auto& IT : MapCurrentCollision)
+    PROFILE_ZONE("Physics::ResolveCollisions");
+    //The delegate are the game code, the actor they delete are remove at the end of the frame
+    MEMORY_SCOPE(MemoryTag_Gameplay);
+    for (auto& IT : _PendingCollisions)
     {
-		PhysicsComponent* CurrPhysicsComponent = IT.first;
-		if (!CurrPhysicsComponent) continue;
-        CurrPhysicsComponent->CorrectMovement(IT.second);
+        if (IT.second.empty() || !IT.first) continue;
+        IT.first->OnCollision.Broadcast(IT.second);
     }
+
+    //Clear keep the capacity for the next physics
+    _PendingCollisions.clear();
 }
 
 void Physics::AddPhysicsActor(const std::string& ActorName, PhysicsComponent* PhysicsComponentToAdd)
 {
     if (!PhysicsComponentToAdd) return;
 
+    FinishPhysics();
     _PhysicsActors[ActorName] = PhysicsComponentToAdd;
 }
 
 void Physics::RemovePhysicsActor(const std::string& Name)
 {
-    _PhysicsActors.erase(Name);
+    FinishPhysics();
+
+    auto IT = _PhysicsActors.find(Name);
+    if (IT == _PhysicsActors.end()) return;
+    PhysicsComponent* RemovedComponent = IT->second;
+    Actor* RemovedActor = RemovedComponent ? RemovedComponent->GetOwner() : nullptr;
+    _PhysicsActors.erase(IT);
+
+    //The collision not resolve cant point on the removed actor
+    _PendingCollisions.erase(std::remove_if(_PendingCollisions.begin(), _PendingCollisions.end(), [RemovedComponent](const auto& Pending)
+    {
+        return Pending.first == RemovedComponent;
+    }), _PendingCollisions.end());
+    for (auto& Pending : _PendingCollisions)
+    {
+        Pending.second.erase(std::remove_if(Pending.second.begin(), Pending.second.end(), [RemovedActor](const CollisionData& Data)
+        {
+            return Data.OtherActor == RemovedActor;
+        }), Pending.second.end());
+    }
 }
 
 std::vector<CollisionData> Physics::CheckCollisionWith(const ICollision* Collision)
@@ -0,0 +1,175 @@
+#include "Profiler/Profiler.h"
+#include "Engine.h"
+#include "Logger/ILogger.h"
+#include <chrono>
+#include <fstream>
+#include <cstdio>
+#include <algorithm>
+
+using namespace NPEngine;
+
+std::atomic<bool> Profiler::_bCapturing = false;
+std::mutex Profiler::_BuffersMutex;
+std::vector<std::unique_ptr<ProfileThreadBuffer>> Profiler::_Buffers;
+int Profiler::_CaptureFramesLeft = 0;
+std::string Profiler::_CapturePath;
+
+//Time 0 of the trace
+static const std::chrono::steady_clock::time_point ProfilerStartTime = std::chrono::steady_clock::now();
+
+void Profiler::BeginCapture()
+{
+	//The other thread can write in there buffer, keep where the capture start and dont touch the count
+	{
+		std::lock_guard<std::mutex> Lock(_BuffersMutex);
+		for (std::unique_ptr<ProfileThreadBuffer>& Buffer : _Buffers)
+		{
+			size_t Count = Buffer->Count.load(std::memory_order_acquire);
+			Buffer->CaptureStart.store(Count, std::memory_order_relaxed);
+			Buffer->CaptureEnd.store(Count, std::memory_order_relaxed);
+		}
+	}
+	_bCapturing.store(true, std::memory_order_release);
+}
+
+void Profiler::EndCapture()
+{
+	_bCapturing.store(false, std::memory_order_release);
+
+	//The zone open before it still add there event, the save stop at this count
+	std::lock_guard<std::mutex> Lock(_BuffersMutex);
+	for (std::unique_ptr<ProfileThreadBuffer>& Buffer : _Buffers)
+	{
+		Buffer->CaptureEnd.store(Buffer->Count.load(std::memory_order_acquire), std::memory_order_relaxed);
+	}
+}
+
+void Profiler::RequestCapture(int FrameCount, const std::string& FilePath)
+{
+	if (FrameCount <= 0) return;
+
+	_CaptureFramesLeft = FrameCount;
+	_CapturePath = FilePath;
+	BeginCapture();
+}
+
+void Profiler::OnEndFrame()
+{
+	if (_CaptureFramesLeft <= 0) return;
+
+	_CaptureFramesLeft--;
+	if (_CaptureFramesLeft > 0) return;
+
+	EndCapture();
+	if (SaveChromeTrace(_CapturePath))
+	{
+		Engine::GetLogger()->LogMessage("Profile capture save in %s", _CapturePath.c_str());
+	}
+}
+
+uint64_t Profiler::GetTime()
+{
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - ProfilerStartTime).count());
+}
+
+ProfileThreadBuffer& Profiler::GetThreadBuffer()
+{
+	//Own by the list, the thread only keep the pointer
+	thread_local ProfileThreadBuffer* ThreadBuffer = nullptr;
+	if (ThreadBuffer) return *ThreadBuffer;
+
+	std::unique_ptr<ProfileThreadBuffer> NewBuffer = std::make_unique<ProfileThreadBuffer>();
+	NewBuffer->Events.resize(_BufferSize);
+
+	std::lock_guard<std::mutex> Lock(_BuffersMutex);
+	NewBuffer->ThreadId = static_cast<uint32_t>(_Buffers.size() + 1);
+	ThreadBuffer = NewBuffer.get();
+	_Buffers.push_back(std::move(NewBuffer));
+	return *ThreadBuffer;
+}
+
+void Profiler::AddEvent(const char* Name, uint64_t Start, uint64_t End)
+{
+	ProfileThreadBuffer& Buffer = GetThreadBuffer();
+
+	//No lock, only this thread write in the buffer
+	size_t Count = Buffer.Count.load(std::memory_order_relaxed);
+	ProfileEvent& Event = Buffer.Events[Count % _BufferSize];
+	Event.Name = Name;
+	Event.Start = Start;
+	Event.End = End;
+	Buffer.Count.store(Count + 1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const char* Name)
+{
+	GetThreadBuffer().ThreadName = Name;
+}
+
+//Write the text in json string, with the character to escape
+static void WriteJsonString(std::ofstream& File, const char* Text)
+{
+	File << '"';
+	for (const char* Character = Text; *Character; Character++)
+	{
+		if (*Character == '"' || *Character == '\\') File << '\\';
+		File << *Character;
+	}
+	File << '"';
+}
+
+//Write the nanosecond time in microsecond, the unit of the trace
+static void WriteMicroseconds(std::ofstream& File, uint64_t Nanoseconds)
+{
+	char Text[32];
+	snprintf(Text, sizeof(Text), "%llu.%03llu", static_cast<unsigned long long>(Nanoseconds / 1000), static_cast<unsigned long long>(Nanoseconds % 1000));
+	File << Text;
+}
+
+bool Profiler::SaveChromeTrace(const std::string& FilePath)
+{
+	std::ofstream File(FilePath);
+	if (!File.is_open())
+	{
+		Engine::GetLogger()->LogMessage("Can't open the profile file %s", FilePath.c_str());
+		return false;
+	}
+
+	std::lock_guard<std::mutex> Lock(_BuffersMutex);
+
+	File << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	bool bFirst = true;
+	for (const std::unique_ptr<ProfileThreadBuffer>& Buffer : _Buffers)
+	{
+		if (!Buffer->ThreadName.empty())
+		{
+			File << (bFirst ? "" : ",") << "\n{\"ph\":\"M\",\"pid\":1,\"tid\":" << Buffer->ThreadId << ",\"name\":\"thread_name\",\"args\":{\"name\":";
+			WriteJsonString(File, Buffer->ThreadName.c_str());
+			File << "}}";
+			bFirst = false;
+		}
+
+		//Only the last _BufferSize event are still in the ring, the zone still open can overwrite the oldest
+		size_t Count = IsCapturing() ? Buffer->Count.load(std::memory_order_acquire) : Buffer->CaptureEnd.load(std::memory_order_relaxed);
+		size_t First = Buffer->CaptureStart.load(std::memory_order_relaxed);
+		if (Count > _BufferSize - _OpenZoneMargin)
+		{
+			First = std::max(First, Count - (_BufferSize - _OpenZoneMargin));
+		}
+		for (size_t i = First; i < Count; i++)
+		{
+			const ProfileEvent& Event = Buffer->Events[i % _BufferSize];
+			File << (bFirst ? "" : ",") << "\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << Buffer->ThreadId << ",\"name\":";
+			WriteJsonString(File, Event.Name);
+			File << ",\"ts\":";
+			WriteMicroseconds(File, Event.Start);
+			File << ",\"dur\":";
+			WriteMicroseconds(File, Event.End - Event.Start);
+			File << "}";
+			bFirst = false;
+		}
+	}
+	File << "\n]}\n";
+
+	return true;
+}
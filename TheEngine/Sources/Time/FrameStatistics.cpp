@@ -0,0 +1,214 @@
+#include "Time/FrameStatistics.h"
+#include "Engine.h"
+#include "Logger/ILogger.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+
+using namespace NPEngine;
+
+FrameStatistics::FrameStatistics()
+{
+	_Frames.resize(_WindowSize);
+	_Histogram.resize(_BucketCount, 0);
+}
+
+void FrameStatistics::AddPhaseTime(EFramePhase Phase, uint64_t Nanoseconds)
+{
+	if (Phase >= FramePhase_Count) return;
+	_CurrentFrame.Phases[Phase] += Nanoseconds;
+}
+
+void FrameStatistics::EndFrame(uint64_t FrameNanoseconds)
+{
+	_CurrentFrame.Total = FrameNanoseconds;
+	_Frames[_FrameCount % _WindowSize] = _CurrentFrame;
+	_FrameCount++;
+	_CurrentFrame = FrameTimes();
+
+	_Histogram[GetBucket(FrameNanoseconds / 1000)]++;
+}
+
+void FrameStatistics::Reset()
+{
+	_FrameCount = 0;
+	_CurrentFrame = FrameTimes();
+	std::fill(_Histogram.begin(), _Histogram.end(), 0);
+}
+
+FrameTimeSummary FrameStatistics::GetSummary(EFramePhase Phase) const
+{
+	FrameTimeSummary Summary;
+	Summary.Count = std::min(_FrameCount, _WindowSize);
+	if (Summary.Count == 0) return Summary;
+
+	std::vector<uint64_t> Times(Summary.Count);
+	uint64_t Sum = 0;
+	for (size_t i = 0; i < Summary.Count; i++)
+	{
+		Times[i] = GetPhaseTime(_Frames[i], Phase);
+		Sum += Times[i];
+	}
+	std::sort(Times.begin(), Times.end());
+
+	//Nearest rank, the percentile is a real frame time
+	auto Percentile = [&Times](double Percent)
+	{
+		size_t Rank = static_cast<size_t>(std::ceil(Percent / 100.0 * Times.size()));
+		return Times[std::clamp<size_t>(Rank, 1, Times.size()) - 1] * 0.000001;
+	};
+
+	Summary.Average = static_cast<double>(Sum) / Summary.Count * 0.000001;
+	Summary.P50 = Percentile(50.0);
+	Summary.P95 = Percentile(95.0);
+	Summary.P99 = Percentile(99.0);
+	Summary.Max = Times.back() * 0.000001;
+	return Summary;
+}
+
+double FrameStatistics::GetPercentile(float Percent, EFramePhase Phase) const
+{
+	size_t Count = std::min(_FrameCount, _WindowSize);
+	if (Count == 0) return 0.0;
+
+	std::vector<uint64_t> Times(Count);
+	for (size_t i = 0; i < Count; i++)
+	{
+		Times[i] = GetPhaseTime(_Frames[i], Phase);
+	}
+
+	size_t Rank = std::clamp<size_t>(static_cast<size_t>(std::ceil(Percent / 100.0 * Count)), 1, Count) - 1;
+	std::nth_element(Times.begin(), Times.begin() + Rank, Times.end());
+	return Times[Rank] * 0.000001;
+}
+
+double FrameStatistics::GetHistogramPercentile(float Percent) const
+{
+	uint64_t Total = 0;
+	for (uint64_t Count : _Histogram)
+	{
+		Total += Count;
+	}
+	if (Total == 0) return 0.0;
+
+	uint64_t Target = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(Percent / 100.0 * Total)), 1);
+	uint64_t Cumulative = 0;
+	for (size_t i = 0; i < _Histogram.size(); i++)
+	{
+		Cumulative += _Histogram[i];
+		if (Cumulative >= Target)
+		{
+			//Highest time of the bucket, the budget check stay safe
+			return (GetBucketStart(i + 1) - 1) * 0.001;
+		}
+	}
+	return (GetBucketStart(_Histogram.size()) - 1) * 0.001;
+}
+
+bool FrameStatistics::IsInBudget(double BudgetMilliseconds, float Percent, EFramePhase Phase) const
+{
+	return GetPercentile(Percent, Phase) <= BudgetMilliseconds;
+}
+
+bool FrameStatistics::SaveCSV(const std::string& Path) const
+{
+	std::ofstream FramesFile(Path + "Frames.csv");
+	std::ofstream SummaryFile(Path + "Summary.csv");
+	std::ofstream HistogramFile(Path + "Histogram.csv");
+	if (!FramesFile.is_open() || !SummaryFile.is_open() || !HistogramFile.is_open())
+	{
+		Engine::GetLogger()->LogMessage("Can't open the frame statistics file %s", Path.c_str());
+		return false;
+	}
+
+	//One line per frame in the window, oldest first, in millisecond
+	FramesFile << "Frame,Total";
+	for (int Phase = 0; Phase < FramePhase_Count; Phase++)
+	{
+		FramesFile << "," << GetPhaseName(static_cast<EFramePhase>(Phase));
+	}
+	FramesFile << "\n";
+	size_t Count = std::min(_FrameCount, _WindowSize);
+	for (size_t i = _FrameCount - Count; i < _FrameCount; i++)
+	{
+		const FrameTimes& Frame = _Frames[i % _WindowSize];
+		FramesFile << i << "," << Frame.Total * 0.000001;
+		for (int Phase = 0; Phase < FramePhase_Count; Phase++)
+		{
+			FramesFile << "," << Frame.Phases[Phase] * 0.000001;
+		}
+		FramesFile << "\n";
+	}
+
+	SummaryFile << "Phase,Average,P50,P95,P99,Max,Count\n";
+	for (int Phase = 0; Phase <= FramePhase_Count; Phase++)
+	{
+		FrameTimeSummary Summary = GetSummary(static_cast<EFramePhase>(Phase));
+		SummaryFile << GetPhaseName(static_cast<EFramePhase>(Phase)) << "," << Summary.Average << "," << Summary.P50 << ","
+			<< Summary.P95 << "," << Summary.P99 << "," << Summary.Max << "," << Summary.Count << "\n";
+	}
+	//All the frame since the start, from the histogram
+	SummaryFile << "AllFrames,," << GetHistogramPercentile(50.0f) << "," << GetHistogramPercentile(95.0f) << ","
+		<< GetHistogramPercentile(99.0f) << "," << GetHistogramPercentile(100.0f) << "," << _FrameCount << "\n";
+
+	HistogramFile << "StartMs,EndMs,Count\n";
+	for (size_t i = 0; i < _Histogram.size(); i++)
+	{
+		if (_Histogram[i] == 0) continue;
+		HistogramFile << GetBucketStart(i) * 0.001 << "," << GetBucketStart(i + 1) * 0.001 << "," << _Histogram[i] << "\n";
+	}
+
+	return true;
+}
+
+const char* FrameStatistics::GetPhaseName(EFramePhase Phase)
+{
+	switch (Phase)
+	{
+	case FramePhase_StartFrame: return "StartFrame";
+	case FramePhase_UpdatePhysics: return "UpdatePhysics";
+	case FramePhase_ProcessInput: return "ProcessInput";
+	case FramePhase_Update: return "Update";
+	case FramePhase_Render: return "Render";
+	case FramePhase_Present: return "Present";
+	case FramePhase_EndFrame: return "EndFrame";
+	case FramePhase_Wait: return "Wait";
+	default: return "Frame";
+	}
+}
+
+uint64_t FrameStatistics::GetTime()
+{
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t FrameStatistics::GetPhaseTime(const FrameTimes& Frame, EFramePhase Phase)
+{
+	return Phase < FramePhase_Count ? Frame.Phases[Phase] : Frame.Total;
+}
+
+size_t FrameStatistics::GetBucket(uint64_t Microseconds)
+{
+	const uint64_t SubBucketCount = 1ull << _SubBucketBits;
+	const uint64_t HalfCount = SubBucketCount / 2;
+	if (Microseconds < SubBucketCount) return static_cast<size_t>(Microseconds);
+
+	//The first bits give the bucket in the power of two
+	int Shift = std::bit_width(Microseconds) - _SubBucketBits;
+	uint64_t SubBucket = Microseconds >> Shift;
+	size_t Bucket = static_cast<size_t>(SubBucketCount + (Shift - 1) * HalfCount + (SubBucket - HalfCount));
+	return std::min(Bucket, _BucketCount - 1);
+}
+
+uint64_t FrameStatistics::GetBucketStart(size_t Bucket)
+{
+	const uint64_t SubBucketCount = 1ull << _SubBucketBits;
+	const uint64_t HalfCount = SubBucketCount / 2;
+	if (Bucket < SubBucketCount) return Bucket;
+
+	uint64_t Index = Bucket - SubBucketCount;
+	int Shift = static_cast<int>(Index / HalfCount) + 1;
+	return (Index % HalfCount + HalfCount) << Shift;
+}
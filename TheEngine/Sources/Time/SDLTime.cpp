@@ -1,38 +1,92 @@
 #include "Time/SDLTime.h"
 
-#include <time.h>
 #include <SDL.h>
+#include <algorithm>
 
 using namespace NPEngine;
 
 bool SDLTime::Initialize(const Param& Params)
 {
+	//Counter in nanosecond or better on all platform, SDL_GetTicks is only in millisecond
+	_CounterFrequency = SDL_GetPerformanceFrequency();
+	//Start with the wake up error of a sleep of 1 ms, grow if a sleep is late
+	_SpinDuration = _CounterFrequency / 1000;
+
 	auto IT = Params.find("FPS");
 	int FramePerSecond = IT != Params.end() ? std::any_cast<int>(IT->second) : 60;
 	SetFramePerSecond(FramePerSecond);
+
+	IT = Params.find("DeltaTimeSmoothing");
+	SetDeltaTimeSmoothing(IT != Params.end() ? std::any_cast<float>(IT->second) : 0.0f);
+
+	IT = Params.find("FixedDeltaTime");
+	SetFixedDeltaTime(IT != Params.end() ? std::any_cast<float>(IT->second) : 0.0f);
+
+	IT = Params.find("FrameStatsPath");
+	if (IT != Params.end())
+	{
+		_FrameStatistics.SetCSVPath(std::any_cast<std::string>(IT->second));
+	}
 	return true;
 }
 
 void SDLTime::Shutdown(const Param& Params)
 {
+	if (!_FrameStatistics.GetCSVPath().empty())
+	{
+		_FrameStatistics.SaveCSV(_FrameStatistics.GetCSVPath());
+	}
 }
 
 float SDLTime::GetDeltaTime()
 {
-	if (_DeltaTime > 0.2f) return 0.2f;
-	return _DeltaTime;
+	//Same step each frame, the run is the same on all machine
+	if (_FixedDeltaTime > 0.0f) return _FixedDeltaTime;
+
+	float DeltaTime = _DeltaTimeSmoothing > 0.0f ? _SmoothDeltaTime : _DeltaTime;
+	if (DeltaTime > 0.2f) return 0.2f;
+	return DeltaTime;
+}
+
+uint64_t SDLTime::GetDeltaTimeNanoseconds() const
+{
+	return _DeltaTimeNanoseconds;
 }
 
 void SDLTime::SetFramePerSecond(int FramePerSecond)
 {
 	_FramesPerSecond = FramePerSecond;
 	if (_FramesPerSecond <= 0) return;
-	_DesiredFrameDuration = 1000 / FramePerSecond;
+	//In counter tick, no integer division in millisecond, 60 FPS is 16.67 ms and not 16
+	_DesiredFrameDuration = _CounterFrequency / static_cast<uint64_t>(FramePerSecond);
+}
+
+void SDLTime::SetDeltaTimeSmoothing(float Smoothing)
+{
+	_DeltaTimeSmoothing = std::clamp(Smoothing, 0.0f, 0.99f);
+	_SmoothDeltaTime = _DeltaTime;
+}
+
+void SDLTime::SetFixedDeltaTime(float DeltaTime)
+{
+	_FixedDeltaTime = DeltaTime;
 }
 
 void SDLTime::UpdateDeltaTime()
 {
-	_DeltaTime = (_CurrentFrameStartTime - _LastFrameStartTime) * 0.001f;
+	uint64_t Ticks = _CurrentFrameStartTime - _LastFrameStartTime;
+	_DeltaTimeNanoseconds = TicksToNanoseconds(Ticks);
+	_DeltaTime = static_cast<float>(static_cast<double>(Ticks) / static_cast<double>(_CounterFrequency));
+
+	//Average with the last frame, a spike is spread on many frame
+	if (_DeltaTimeSmoothing > 0.0f && _SmoothDeltaTime > 0.0f)
+	{
+		_SmoothDeltaTime = _SmoothDeltaTime * _DeltaTimeSmoothing + _DeltaTime * (1.0f - _DeltaTimeSmoothing);
+	}
+	else
+	{
+		_SmoothDeltaTime = _DeltaTime;
+	}
 }
 
 void SDLTime::UpdateLastFrameStartTime()
@@ -42,21 +96,35 @@ void SDLTime::UpdateLastFrameStartTime()
 
 void SDLTime::UpdateCurrentFrameStartTime()
 {
-	_CurrentFrameStartTime = SDL_GetTicks();
+	_CurrentFrameStartTime = SDL_GetPerformanceCounter();
 }
 
 void SDLTime::ControlFrameRate()
 {
 	if (_FramesPerSecond <= 0) return;
 
-	long CurrentTime = SDL_GetTicks();
+	FramePhaseTimer PhaseTimer(_FrameStatistics, FramePhase_Wait);
+	uint64_t EndTime = _CurrentFrameStartTime + _DesiredFrameDuration;
 
-	long CurrentFrameTime = CurrentTime - _CurrentFrameStartTime;
+	//Sleep 1 ms at a time while the end is far, the thread give is core to the other
+	uint64_t CurrentTime = SDL_GetPerformanceCounter();
+	while (CurrentTime < EndTime && EndTime - CurrentTime > _SpinDuration)
+	{
+		SDL_Delay(1);
+		uint64_t WakeUpTime = SDL_GetPerformanceCounter();
 
-	if (CurrentFrameTime < _DesiredFrameDuration)
+		//A late wake up on a loaded machine, spin longer the next time
+		_SpinDuration = std::min(std::max(_SpinDuration, WakeUpTime - CurrentTime), _DesiredFrameDuration);
+		CurrentTime = WakeUpTime;
+	}
+
+	//Spin the last part, a sleep would wake up after the end
+	while (SDL_GetPerformanceCounter() < EndTime)
 	{
-		SDL_Delay(_DesiredFrameDuration - CurrentFrameTime);
 	}
+
+	//Go back slowly to 1 ms, one late wake up dont make all the next frame spin
+	_SpinDuration = std::max(_SpinDuration - _SpinDuration / 32, _CounterFrequency / 1000);
 }
 
 void SDLTime::InitialiseTime()
@@ -74,5 +142,12 @@ void SDLTime::OnStartFrame()
 void SDLTime::OnEndFrame()
 {
 	ControlFrameRate();
+	_FrameStatistics.EndFrame(TicksToNanoseconds(SDL_GetPerformanceCounter() - _CurrentFrameStartTime));
 	UpdateLastFrameStartTime();
-}
\ No newline at end of file
+}
+
+uint64_t SDLTime::TicksToNanoseconds(uint64_t Ticks) const
+{
+	//Split the second and the rest, Ticks * 1e9 can overflow
+	return Ticks / _CounterFrequency * 1000000000ull + Ticks % _CounterFrequency * 1000000000ull / _CounterFrequency;
+}
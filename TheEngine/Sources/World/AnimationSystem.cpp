@@ -0,0 +1,177 @@
+#include "World/AnimationSystem.h"
+#include "Object/Component/AnimationComponent.h"
+
+using namespace NPEngine;
+
+int AnimationSystem::AddComponent(AnimationComponent* Component)
+{
+	int Slot = static_cast<int>(_Components.size());
+	int Tile = Component->GetTileIndex();
+
+	//Without clip the slot is stop on is tile
+	_Components.push_back(Component);
+	_ClipIds.push_back(-1);
+	_FrameTimes.push_back(0.0f);
+	_TileIndices.push_back(Tile);
+	_FrameIntervals.push_back(0.0f);
+	_StartIndices.push_back(Tile);
+	_EndIndices.push_back(Tile);
+	_StopIndices.push_back(Tile);
+	_SwitchIndices.push_back(-1);
+	_bSteps.push_back(0);
+
+	//The clip can be set before the component is add
+	int ClipId = Component->GetCurrentAnimation();
+	const AnimationClip* Clip = Component->GetAnimationClip(ClipId);
+	if (Clip)
+	{
+		SetClip(Slot, ClipId, Clip);
+		_TileIndices[Slot] = Tile;
+	}
+
+	return Slot;
+}
+
+void AnimationSystem::RemoveComponent(int Slot)
+{
+	if (Slot < 0 || Slot >= static_cast<int>(_Components.size())) return;
+
+	size_t Last = _Components.size() - 1;
+	if (static_cast<size_t>(Slot) != Last)
+	{
+		_Components[Slot] = _Components[Last];
+		_ClipIds[Slot] = _ClipIds[Last];
+		_FrameTimes[Slot] = _FrameTimes[Last];
+		_TileIndices[Slot] = _TileIndices[Last];
+		_FrameIntervals[Slot] = _FrameIntervals[Last];
+		_StartIndices[Slot] = _StartIndices[Last];
+		_EndIndices[Slot] = _EndIndices[Last];
+		_StopIndices[Slot] = _StopIndices[Last];
+		_SwitchIndices[Slot] = _SwitchIndices[Last];
+		_bSteps[Slot] = _bSteps[Last];
+
+		_Components[Slot]->_AnimationSlot = Slot;
+	}
+
+	_Components.pop_back();
+	_ClipIds.pop_back();
+	_FrameTimes.pop_back();
+	_TileIndices.pop_back();
+	_FrameIntervals.pop_back();
+	_StartIndices.pop_back();
+	_EndIndices.pop_back();
+	_StopIndices.pop_back();
+	_SwitchIndices.pop_back();
+	_bSteps.pop_back();
+}
+
+void AnimationSystem::SetClip(int Slot, int ClipId, const AnimationClip* Clip)
+{
+	if (Slot < 0 || Slot >= static_cast<int>(_Components.size()) || !Clip) return;
+
+	_ClipIds[Slot] = ClipId;
+	_FrameTimes[Slot] = 0.0f;
+	_TileIndices[Slot] = Clip->StartIndex;
+	_FrameIntervals[Slot] = Clip->FrameInterval;
+	_StartIndices[Slot] = Clip->StartIndex;
+	_EndIndices[Slot] = Clip->EndIndex;
+	_StopIndices[Slot] = Clip->bLoop ? -1 : Clip->EndIndex;
+	_SwitchIndices[Slot] = Clip->SwitchClipId >= 0 ? Clip->SwitchIndex : -1;
+}
+
+void AnimationSystem::Update(float DeltaTime)
+{
+	const int Count = static_cast<int>(_Components.size());
+	if (Count == 0) return;
+
+	float* FrameTimes = _FrameTimes.data();
+	int* TileIndices = _TileIndices.data();
+	const float* FrameIntervals = _FrameIntervals.data();
+	const int* StartIndices = _StartIndices.data();
+	const int* EndIndices = _EndIndices.data();
+	const int* StopIndices = _StopIndices.data();
+	const int* SwitchIndices = _SwitchIndices.data();
+	int* bSteps = _bSteps.data();
+
+	//Advance the time of all slot, the loop have no branch so the compiler can vectorize it
+	for (int i = 0; i < Count; i++)
+	{
+		int bPlay = TileIndices[i] != StopIndices[i];
+		float Time = FrameTimes[i] + DeltaTime * static_cast<float>(bPlay);
+		int bStep = Time >= FrameIntervals[i] ? bPlay : 0;
+		FrameTimes[i] = bStep ? 0.0f : Time;
+		bSteps[i] = bStep;
+	}
+
+	//Advance the tile of the slot that step, a slot at the switch index keep is tile and is mark 2 for the switch after
+	for (int i = 0; i < Count; i++)
+	{
+		int Tile = TileIndices[i];
+		int Start = StartIndices[i];
+		int End = EndIndices[i];
+		int Switch = SwitchIndices[i];
+		int bStep = bSteps[i];
+		int bAdvance = Tile != Switch ? bStep : 0;
+		int NextTile = Tile < End ? Tile + 1 : Start;
+		TileIndices[i] = bAdvance ? NextTile : Tile;
+		bSteps[i] = bStep + bStep - bAdvance;
+	}
+
+	//Only the slot that step go back in the component
+	for (int i = 0; i < Count; i++)
+	{
+		if (!bSteps[i]) continue;
+
+		AnimationComponent* Component = _Components[i];
+		const AnimationClip* Clip = Component->GetAnimationClip(_ClipIds[i]);
+		if (!Clip) continue;
+
+		if (bSteps[i] == 2)
+		{
+			//Only change the arrays at this slot
+			Component->PlayClip(Clip->SwitchClipId);
+			Clip = Component->GetAnimationClip(_ClipIds[i]);
+		}
+		else
+		{
+			Component->SetTileIndex(TileIndices[i]);
+		}
+
+		if (Clip && Clip->CallObserverAt(TileIndices[i]))
+		{
+			AnimationEvent NewEvent = AnimationEvent();
+			NewEvent.Component = Component;
+			NewEvent.FrameIndex = TileIndices[i];
+			NewEvent.ClipId = _ClipIds[i];
+			_Events.push_back(NewEvent);
+		}
+	}
+
+	//Observer can change the animation, they are call when all slot are update
+	for (size_t i = 0; i < _Events.size(); i++)
+	{
+		AnimationEvent CurrEvent = _Events[i];
+		CurrEvent.Component->AnimationObserver.Broadcast(CurrEvent.FrameIndex, CurrEvent.ClipId);
+	}
+	_Events.clear();
+}
+
+void AnimationSystem::Clear()
+{
+	for (AnimationComponent* Component : _Components)
+	{
+		Component->_AnimationSlot = -1;
+	}
+
+	_Components.clear();
+	_ClipIds.clear();
+	_FrameTimes.clear();
+	_TileIndices.clear();
+	_FrameIntervals.clear();
+	_StartIndices.clear();
+	_EndIndices.clear();
+	_StopIndices.clear();
+	_SwitchIndices.clear();
+	_bSteps.clear();
+	_Events.clear();
+}
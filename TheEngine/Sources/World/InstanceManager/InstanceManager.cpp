@@ -106,3 +106,22 @@ Actor* InstanceManager::SpawnCopyInWorldAt(std::string Name, std::string CopyNam
 
 	return CopyInstance;
 }
+
+Actor* InstanceManager::SpawnCopyInWorldAt(std::string Name, std::string CopyName, const Param& Params)
+{
+	auto IT = _Instances.find(Name);
+	if (IT == _Instances.end()) return nullptr;
+
+	InstanceActor& CurrInstanceActor = IT->second;
+
+	Actor* Instance = CurrInstanceActor.ActorInstance;
+	Actor* CopyInstance = Instance->Clone(CopyName, CurrInstanceActor.CloneParam);
+
+	//Each copy can have is position or is velocity
+	Param InitialiseParams = Params;
+	InitialiseParams.insert(CurrInstanceActor.InitialiseParams.begin(), CurrInstanceActor.InitialiseParams.end());
+
+	Engine::GetWorld()->AddActor(CopyInstance, InitialiseParams);
+
+	return CopyInstance;
+}
@@ -1,6 +1,11 @@
 #include "World/World.h"
 #include "Object/Actor/Actor.h"
 #include "Engine.h"
+#include "Profiler/Profiler.h"
+#include "Memory/MemoryTracker.h"
+#include "Object/Component/IUpdatableComponent.h"
+
+#include <algorithm>
 
 using namespace NPEngine;
 
@@ -11,35 +16,44 @@ bool World::Initialize(const Param& Params)
 
 void World::Shutdown(const Param& Params)
 {
+	WaitTickGroups();
 	UnloadWorld();
+	_AnimationSystem.Clear();
 }
 
 //Flow function ---------------------------------------------
 
 void World::StartFrame()
 {
+	MEMORY_SCOPE(MemoryTag_World);
+
 	//Check for load new scene
 	if (_DataLoadScene.bLoadScene)
 	{
+		PROFILE_ZONE("World::LoadScene");
 		OnLoadScene();
 	}
 
 	//Check for add new actor
 	if (!_ActorsToAdd.empty())
 	{
+		PROFILE_ZONE("World::CreateActor");
 		OnCreateActor();
 		_ActorsToAdd.clear();
 	}
 
 	if (!_ActorsToCallCreateComponent.empty())
 	{
+		PROFILE_ZONE("World::CreateComponent");
 		OnCallActorCreateComponent();
 		_ActorsToCallCreateComponent.clear();
+		ResetTickOrder();
 	}
 
 	//Begin play
 	if (!_ActorsToCallBeginPlay.empty())
 	{
+		PROFILE_ZONE("World::BeginPlay");
 		for (std::string& Name : _ActorsToCallBeginPlay)
 		{
 			Actor* CurrActor = GetActorByName(Name);
@@ -57,27 +71,163 @@ void World::StartFrame()
 
 void World::Update(float DeltaTime)
 {
+	RunTickGroup(TickGroup_PostPhysics, DeltaTime);
+
+	//On the main thread while the parallel update of the group run
+	PROFILE_ZONE("World::UpdateAnimations");
+	_AnimationSystem.Update(DeltaTime);
+}
+
+void World::RunTickGroup(ETickGroup Group, float DeltaTime)
+{
+	if (Group >= TickGroup_Count) return;
+
+	PROFILE_ZONE(GetTickGroupName(Group));
+
+	//The parallel update keep the index in the list, build it when nothing run
+	if (_bTickOrderDirty)
+	{
+		WaitTickGroups();
+		BuildTickOrder();
+	}
+
+	for (uint8_t i = 0; i < TickGroup_Count; i++)
+	{
+		if (_TickGroupPrerequisites[Group] & (1 << i))
+		{
+			WaitTickGroup(static_cast<ETickGroup>(i));
+		}
+	}
+
+	//Start the parallel update first, the main thread run the other at the same time
+	const std::vector<TickFunction>& ParallelTicks = _ParallelTickFunctions[Group];
+	if (!ParallelTicks.empty())
+	{
+		IJobSystem* JobSystem = Engine::GetJobSystem();
+		size_t ChunkCount = std::min<size_t>(ParallelTicks.size(), static_cast<size_t>(std::max(JobSystem->GetWorkerCount(), 1)) * 2);
+		size_t ChunkSize = (ParallelTicks.size() + ChunkCount - 1) / ChunkCount;
+		for (size_t Start = 0; Start < ParallelTicks.size(); Start += ChunkSize)
+		{
+			size_t End = std::min(Start + ChunkSize, ParallelTicks.size());
+			_TickGroupJobs[Group].push_back(JobSystem->AddJob([this, Group, Start, End, DeltaTime]()
+			{
+				PROFILE_ZONE("World::ParallelTick");
+				MEMORY_SCOPE(MemoryTag_Gameplay);
+				for (size_t i = Start; i < End; i++)
+				{
+					CallTick(_ParallelTickFunctions[Group][i], DeltaTime);
+				}
+			}));
+		}
+	}
+
+	for (const TickFunction& Tick : _TickFunctions[Group])
+	{
+		CallTick(Tick, DeltaTime);
+	}
+}
+
+void World::WaitTickGroups()
+{
+	for (uint8_t i = 0; i < TickGroup_Count; i++)
+	{
+		WaitTickGroup(static_cast<ETickGroup>(i));
+	}
+}
+
+void World::WaitTickGroup(ETickGroup Group)
+{
+	if (_TickGroupJobs[Group].empty()) return;
+
+	PROFILE_ZONE("World::WaitTickGroup");
+	//The completion of the load are call at the frame start, not in the middle of the frame
+	for (const JobHandle& Handle : _TickGroupJobs[Group])
+	{
+		Engine::GetJobSystem()->Wait(Handle, false);
+	}
+	_TickGroupJobs[Group].clear();
+}
+
+void World::BuildTickOrder()
+{
+	PROFILE_ZONE("World::BuildTickOrder");
+	for (uint8_t i = 0; i < TickGroup_Count; i++)
+	{
+		_TickFunctions[i].clear();
+		_ParallelTickFunctions[i].clear();
+	}
+
+	//Same order as the actor map in each group
 	for (auto& Value : _Actors)
 	{
 		Actor* CurrActor = Value.second;
 		if (!CurrActor) continue;
 
 		IActorWorld* ActorWorld = static_cast<IActorWorld*>(CurrActor);
-		if (ActorWorld)
-		{
-			ActorWorld->Update(DeltaTime);
-		}
+		ActorWorld->AddTickFunctions(_TickFunctions, _ParallelTickFunctions);
+	}
+
+	_bTickOrderDirty = false;
+}
+
+void World::CallTick(const TickFunction& Tick, float DeltaTime)
+{
+	if (Tick.Component)
+	{
+		Tick.Component->Update(DeltaTime);
+		return;
+	}
+
+	IActorWorld* ActorWorld = static_cast<IActorWorld*>(Tick.Owner);
+	if (ActorWorld)
+	{
+		ActorWorld->Update(DeltaTime);
+	}
+}
+
+void World::AddTickGroupPrerequisite(ETickGroup Group, ETickGroup Prerequisite)
+{
+	//A group after in the frame is not start when the group start
+	if (Group >= TickGroup_Count || Prerequisite >= Group)
+	{
+		Engine::GetLogger()->LogMessage("The prerequisite of a tick group must be before it in the frame");
+		return;
 	}
+
+	_TickGroupPrerequisites[Group] |= 1 << Prerequisite;
+}
+
+void World::RemoveTickGroupPrerequisite(ETickGroup Group, ETickGroup Prerequisite)
+{
+	if (Group >= TickGroup_Count || Prerequisite >= TickGroup_Count) return;
+
+	_TickGroupPrerequisites[Group] &= ~(1 << Prerequisite);
 }
 
 void World::PostUpdate()
 {
 }
 
+void World::SaveDrawTransforms()
+{
+	MEMORY_SCOPE(MemoryTag_World);
+	//The transform are final when all the update before the render are done
+	WaitTickGroups();
+	PROFILE_ZONE("World::SaveDrawTransforms");
+	for (auto& Value : _Actors)
+	{
+		Actor* CurrActor = Value.second;
+		if (!CurrActor) continue;
+
+		CurrActor->SaveDrawTransform();
+	}
+}
+
 void World::Render()
 {
 	if (_DrawActorOrder.empty())
 	{
+		PROFILE_ZONE("World::SortDrawOrder");
 		for (auto& IT : _Actors)
 		{
 			Actor* CurrActor = IT.second;
@@ -92,6 +242,10 @@ void World::Render()
 		}
 	}
 
+	//Actor out of the camera are not draw
+	PROFILE_ZONE("World::DrawActors");
+	Rectangle2D<float> ViewRect = Engine::GetGraphics()->GetViewRect();
+
 	for (std::vector<Actor*>& Layer : _DrawActorOrder)
 	{
 		for (Actor* DrawActor : Layer)
@@ -99,7 +253,7 @@ void World::Render()
 			if(!DrawActor) continue;
 
 			IActorWorld* ActorWorld = static_cast<IActorWorld*>(DrawActor);
-			if (ActorWorld)
+			if (ActorWorld && ActorWorld->IsInView(ViewRect))
 			{
 				ActorWorld->Draw();
 			}
@@ -113,15 +267,22 @@ void World::PostRender()
 
 void World::EndFrame()
 {
+	MEMORY_SCOPE(MemoryTag_World);
+	//No update can run on a actor to delete
+	WaitTickGroups();
+
 	if (!_ActorsToCallDeleteComponent.empty())
 	{
+		PROFILE_ZONE("World::DeleteComponent");
 		OnCallActorDeleteComponent();
 		_ActorsToCallDeleteComponent.clear();
+		ResetTickOrder();
 	}
 
 	//Check for delete actor
 	if (!_ActorsToDelete.empty())
 	{
+		PROFILE_ZONE("World::DeleteActor");
 		OnDeleteActor();
 		_ActorsToDelete.clear();
 	}
@@ -174,6 +335,7 @@ void World::OnDeleteActor()
 	}
 
 	ResetDrawOrder();
+	ResetTickOrder();
 }
 
 void World::OnCreateActor()
@@ -218,6 +380,7 @@ void World::OnCreateActor()
 	}
 
 	ResetDrawOrder();
+	ResetTickOrder();
 }
 
 void World::OnCallActorCreateComponent()
@@ -350,6 +513,7 @@ void World::UnloadScene()
 	_Actors.clear();
 
 	ResetDrawOrder();
+	ResetTickOrder();
 }
 
 void World::OnLoadScene()
@@ -3,11 +3,24 @@ const fs = require('fs');
 let project = new Project('TheEngine');
 
 project.addProvider = function(proj, isRoot=false){
-    proj.addIncludeDir("C:/Program Files (x86)/Visual Leak Detector/include");
-    proj.addIncludeDir("C:/Program Files (x86)/Visual Leak Detector/include");
-    proj.addLib("C:/Program Files (x86)/Visual Leak Detector/lib/Win64/vld");
+    //The leak detector and the SDL dll only exist on windows
+    const windows = platform === Platform.Windows;
+    if(windows){
+        proj.addIncludeDir("C:/Program Files (x86)/Visual Leak Detector/include");
+        proj.addLib("C:/Program Files (x86)/Visual Leak Detector/lib/Win64/vld");
+    }
+    //Build with the PROFILE_ zone, without it they compile to nothing
+    const profiler = process.argv.indexOf("--profiler") >= 0;
+    if(profiler){
+        proj.addDefine("ENABLE_PROFILER");
+    }
+    //Build with the global new hook of the memory tracker and the MEMORY_SCOPE tag
+    const memory = process.argv.indexOf("--memory") >= 0;
+    if(memory){
+        proj.addDefine("ENABLE_MEMORY_TRACKING");
+    }
     const sdl2 = true;//process.argv.indexOf("--sdl2") >= 0;
-    if(sdl2){
+    if(sdl2 && windows){
         fs.copyFileSync("./SDL/lib/SDL2.dll", "./Deployment/SDL2.dll");
         fs.copyFileSync("./SDL/lib/SDL2_image.dll", "./Deployment/SDL2_image.dll");
         fs.copyFileSync("./SDL/lib/SDL2_ttf.dll", "./Deployment/SDL2_ttf.dll");
@@ -22,6 +35,18 @@ project.addProvider = function(proj, isRoot=false){
         proj.addLib("./SDL/lib/SDL2_ttf");
         proj.addLib("./SDL/lib/SDL2_mixer");
     }
+    else if(sdl2){
+        //The SDL of the system, install the dev package of SDL2, SDL2_image, SDL2_ttf and SDL2_mixer
+        if(!isRoot){
+            proj.addDefine("USE_SDL");
+            proj.addIncludeDir("/usr/include/SDL2");
+        }
+        proj.addLib("SDL2");
+        proj.addLib("SDL2_image");
+        proj.addLib("SDL2_ttf");
+        proj.addLib("SDL2_mixer");
+        proj.addLib("pthread");
+    }
 };
 project.kore = false;
 project.setCppStd("C++20");
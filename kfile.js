@@ -1,10 +1,28 @@
-let project = new Project("BOI");
+//Build the headless benchmark instead of the game, it run the game scene without window
+const benchmark = process.argv.indexOf("--benchmark") >= 0;
+//Build the benchmark of the engine primitive, without the game
+const microbenchmark = process.argv.indexOf("--microbenchmark") >= 0;
+//Build the dedicated simulation, it run the game matches without window for the server
+const simulation = process.argv.indexOf("--simulation") >= 0;
+let project = new Project(microbenchmark ? "MicroBenchmark" : benchmark ? "Benchmark" : simulation ? "Simulation" : "BOI");
 
 project.kore = false;
 
-project.addFiles(
-    "BOI/**",
-);
+if(!microbenchmark){
+    project.addFiles(
+        "BOI/**",
+    );
+}
+if(benchmark || microbenchmark){
+    project.addFiles("Benchmark/**");
+    project.addExclude("BOI/Sources/Main.cpp");
+    project.addExclude(microbenchmark ? "Benchmark/Sources/BenchmarkMain.cpp" : "Benchmark/Sources/MicroBenchmarkMain.cpp");
+    project.addIncludeDir("./Benchmark/Includes");
+}
+if(simulation){
+    project.addFiles("Simulation/**");
+    project.addExclude("BOI/Sources/Main.cpp");
+}
 
 project.setDebugDir("Deployment");
 